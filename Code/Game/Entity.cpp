@@ -5,6 +5,10 @@
 //----------------------------------------------------------------------------------------------------
 #include "Game/Entity.hpp"
 
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Game/Framework/TransformBatch.hpp"
+
 //----------------------------------------------------------------------------------------------------
 Entity::Entity(Game* owner)
     : m_game(owner)
@@ -16,9 +20,17 @@ Entity::~Entity()
 {
 }
 
+//----------------------------------------------------------------------------------------------------
+// m_position and m_orientation are public and written directly by gameplay code, so instead of a dirty
+// flag the cache remembers the values it was built from; an entity that has not moved costs a compare.
 //----------------------------------------------------------------------------------------------------
 Mat44 Entity::GetModelToWorldTransform() const
 {
+    if (m_isModelToWorldCacheValid && m_cachedPosition == m_position && AreOrientationsEqual(m_cachedOrientation, m_orientation))
+    {
+        return m_cachedModelToWorld;
+    }
+
     Mat44 m2w;
 
     m2w.SetTranslation3D(m_position);
@@ -29,5 +41,45 @@ Mat44 Entity::GetModelToWorldTransform() const
 
     // m2w.Append(m_orientation.GetAsMatrix_IFwd_JLeft_KUp());
 
+    m_cachedModelToWorld       = m2w;
+    m_cachedPosition           = m_position;
+    m_cachedOrientation        = m_orientation;
+    m_isModelToWorldCacheValid = true;
+
+    return m2w;
+}
+
+//----------------------------------------------------------------------------------------------------
+void Entity::SavePreviousTransform()
+{
+    m_previousPosition    = m_position;
+    m_previousOrientation = m_orientation;
+}
+
+//----------------------------------------------------------------------------------------------------
+Vec3 Entity::GetInterpolatedPosition(float const alpha) const
+{
+    return m_previousPosition + (m_position - m_previousPosition) * alpha;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Euler angles are interpolated per component; orientations only change by a small step between the two.
+//----------------------------------------------------------------------------------------------------
+Mat44 Entity::GetInterpolatedModelToWorldTransform(float const alpha) const
+{
+    // Nothing changed during the last step: every alpha gives the current (cached) transform
+    if (m_previousPosition == m_position && AreOrientationsEqual(m_previousOrientation, m_orientation))
+    {
+        return GetModelToWorldTransform();
+    }
+
+    Mat44 m2w;
+
+    m2w.SetTranslation3D(GetInterpolatedPosition(alpha));
+
+    m2w.AppendZRotation(Interpolate(m_previousOrientation.m_yawDegrees, m_orientation.m_yawDegrees, alpha));
+    m2w.AppendYRotation(Interpolate(m_previousOrientation.m_pitchDegrees, m_orientation.m_pitchDegrees, alpha));
+    m2w.AppendXRotation(Interpolate(m_previousOrientation.m_rollDegrees, m_orientation.m_rollDegrees, alpha));
+
     return m2w;
 }
@@ -6,6 +6,7 @@
 #pragma once
 #include "Engine/Core/Rgba8.hpp"
 #include "Engine/Math/EulerAngles.hpp"
+#include "Engine/Math/Mat44.hpp"
 #include "Engine/Math/Vec3.hpp"
 
 //----------------------------------------------------------------------------------------------------
@@ -20,12 +21,28 @@ public:
 
     virtual void  Update(float deltaSeconds) = 0;
     virtual void  Render() const = 0;
+    // Cached: rebuilt only when m_position or m_orientation differ from the values the cache was built from.
     virtual Mat44 GetModelToWorldTransform() const;
 
+    // Fixed-step rendering: call SavePreviousTransform before each simulation step (or after a teleport),
+    // then render between the previous and current transform with the step's interpolation alpha.
+    void  SavePreviousTransform();
+    Vec3  GetInterpolatedPosition(float alpha) const;
+    Mat44 GetInterpolatedModelToWorldTransform(float alpha) const;
+
     Game*       m_game            = nullptr;
     Vec3        m_position        = Vec3::ZERO;
     Vec3        m_velocity        = Vec3::ZERO;
     EulerAngles m_orientation     = EulerAngles::ZERO;
     EulerAngles m_angularVelocity = EulerAngles::ZERO;
     Rgba8       m_color           = Rgba8::WHITE;
+
+    Vec3        m_previousPosition    = Vec3::ZERO;
+    EulerAngles m_previousOrientation = EulerAngles::ZERO;
+
+private:
+    mutable Mat44       m_cachedModelToWorld;
+    mutable Vec3        m_cachedPosition           = Vec3::ZERO;
+    mutable EulerAngles m_cachedOrientation        = EulerAngles::ZERO;
+    mutable bool        m_isModelToWorldCacheValid = false;
 };
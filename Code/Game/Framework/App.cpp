@@ -10,6 +10,8 @@
 #include "Engine/Core/DevConsole.hpp"
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Engine/Core/XmlUtils.hpp"
 #include "Engine/Input/InputSystem.hpp"
 #include "Engine/Math/RandomNumberGenerator.hpp"
 #include "Engine/Platform/Window.hpp"
@@ -19,7 +21,10 @@
 #include "Engine/Resource/ResourceSubsystem.hpp"
 #include "Engine/Scripting/V8Subsystem.hpp"
 #include "Game/Game.hpp"
+#include "Game/Framework/FrameProfiler.hpp"
 #include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/JobSystem.hpp"
+#include "Game/Framework/ScriptCallProfiler.hpp"
 #include "Game/Subsystem/Light/LightSubsystem.hpp"
 
 //----------------------------------------------------------------------------------------------------
@@ -27,6 +32,7 @@ App*                   g_theApp               = nullptr;       // Created and ow
 AudioSystem*           g_theAudio             = nullptr;       // Created and owned by the App
 BitmapFont*            g_theBitmapFont        = nullptr;       // Created and owned by the App
 Game*                  g_theGame              = nullptr;       // Created and owned by the App
+JobSystem*             g_theJobSystem         = nullptr;       // Created and owned by the App
 Renderer*              g_theRenderer          = nullptr;       // Created and owned by the App
 RandomNumberGenerator* g_theRNG               = nullptr;       // Created and owned by the App
 Window*                g_theWindow            = nullptr;       // Created and owned by the App
@@ -36,6 +42,43 @@ ResourceSubsystem*     g_theResourceSubsystem = nullptr;       // Created and ow
 //----------------------------------------------------------------------------------------------------
 STATIC bool App::m_isQuitting = false;
 
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    using ScriptGlobalFunction = std::function<std::any(std::vector<std::any> const&)>;
+
+    //------------------------------------------------------------------------------------------------
+    // 以 ScriptCallProfiler 包裝全域函式；分析器停用時只多一次旗標檢查
+    //------------------------------------------------------------------------------------------------
+    ScriptGlobalFunction ProfileScriptGlobal(char const* name, ScriptGlobalFunction function)
+    {
+        uint32_t const profileSlot = ScriptCallProfiler::RegisterEntry(name);
+
+        return [profileSlot, function = std::move(function)](std::vector<std::any> const& args) -> std::any {
+            if (!ScriptCallProfiler::IsEnabled())
+            {
+                return function(args);
+            }
+
+            uint64_t const startNs = ScriptCallProfiler::GetTimeNs();
+            std::any       result  = function(args);
+
+            ScriptCallProfiler::Record(profileSlot, ScriptCallProfiler::GetTimeNs() - startNs, 0);
+            return result;
+        };
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // GameConfig.xml 的子元素以文字存放數值（<name>value</name>）；檔案或元素不存在時使用預設值
+    //------------------------------------------------------------------------------------------------
+    int GetGameConfigInt(XmlElement const* root, char const* elementName, int const defaultValue)
+    {
+        XmlElement const* element = root ? root->FirstChildElement(elementName) : nullptr;
+
+        return element ? element->IntText(defaultValue) : defaultValue;
+    }
+}
+
 //----------------------------------------------------------------------------------------------------
 void App::Startup()
 {
@@ -45,6 +88,9 @@ void App::Startup()
     g_theEventSystem = new EventSystem(sEventSystemConfig);
     g_theEventSystem->SubscribeEventCallbackFunction("OnCloseButtonClicked", OnCloseButtonClicked);
     g_theEventSystem->SubscribeEventCallbackFunction("quit", OnCloseButtonClicked);
+    g_theEventSystem->SubscribeEventCallbackFunction("ScriptProfile", ScriptCallProfiler::OnScriptProfileCommand);
+    g_theEventSystem->SubscribeEventCallbackFunction("FrameProfile", FrameProfiler::OnFrameProfileCommand);
+    g_theEventSystem->SubscribeEventCallbackFunction("FramePace", OnFramePaceCommand);
 
     //-End-of-EventSystem-----------------------------------------------------------------------------
     //------------------------------------------------------------------------------------------------
@@ -125,13 +171,27 @@ void App::Startup()
     //------------------------------------------------------------------------------------------------
     //-Start-of-ResourceSubsystem---------------------------------------------------------------------
 
+    XmlDocument       gameConfig;
+    XmlElement const* gameConfigRoot = gameConfig.LoadFile("Data/GameConfig.xml") == tinyxml2::XML_SUCCESS ? gameConfig.RootElement() : nullptr;
+
     sResourceSubsystemConfig resourceSubsystemConfig;
-    resourceSubsystemConfig.m_threadCount = 4;
+    resourceSubsystemConfig.m_threadCount = std::max(GetGameConfigInt(gameConfigRoot, "resourceThreadCount", 4), 1);
 
     g_theResourceSubsystem = new ResourceSubsystem(resourceSubsystemConfig);
 
     //-End-of-ResourceSubsystem-----------------------------------------------------------------------
     //------------------------------------------------------------------------------------------------
+    //-Start-of-JobSystem-----------------------------------------------------------------------------
+
+    // 資源載入執行緒常駐，自動決定工作執行緒數時把它們扣除，兩者合計不超過硬體執行緒數
+    sJobSystemConfig jobSystemConfig;
+    jobSystemConfig.m_workerThreadCount   = static_cast<uint32_t>(std::max(GetGameConfigInt(gameConfigRoot, "jobThreadCount", 0), 0));
+    jobSystemConfig.m_reservedThreadCount = static_cast<uint32_t>(resourceSubsystemConfig.m_threadCount);
+
+    g_theJobSystem = new JobSystem(jobSystemConfig);
+
+    //-End-of-JobSystem-------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------------------------
     //-Start-of-V8Subsystem--------------------------------------------------------------------------
 
     sV8SubsystemConfig v8Config;
@@ -175,6 +235,7 @@ void App::Shutdown()
 
     // Destroy all Engine Subsystem
     GAME_SAFE_RELEASE(g_theGame);
+    GAME_SAFE_RELEASE(g_theJobSystem);
     GAME_SAFE_RELEASE(g_theRNG);
     GAME_SAFE_RELEASE(g_theBitmapFont);
 
@@ -203,6 +264,9 @@ void App::Shutdown()
 //
 void App::RunFrame()
 {
+    FrameProfiler::BeginFrame();
+    PROFILE_SCOPE("App::RunFrame");
+
     BeginFrame();   // Engine pre-frame stuff
     Update();       // Game updates / moves / spawns / hurts / kills stuff
     Render();       // Game draws current state of things
@@ -215,8 +279,8 @@ void App::RunMainLoop()
     // Program main loop; keep running frames until it's time to quit
     while (!m_isQuitting)
     {
-        // Sleep(16); // Temporary code to "slow down" our app to ~60Hz until we have proper frame timing in
         RunFrame();
+        m_framePacer.WaitForNextFrame();
     }
 }
 
@@ -230,6 +294,32 @@ STATIC bool App::OnCloseButtonClicked(EventArgs& args)
     return true;
 }
 
+//----------------------------------------------------------------------------------------------------
+// FramePace fps=<n> 設定目標幀率（0 為不限制）；不帶參數時輸出上一個統計區間的幀時間
+//----------------------------------------------------------------------------------------------------
+STATIC bool App::OnFramePaceCommand(EventArgs& args)
+{
+    if (!g_theApp || !g_theDevConsole)
+    {
+        return false;
+    }
+
+    FramePacer& framePacer = g_theApp->m_framePacer;
+    float const targetFps  = args.GetValue("fps", framePacer.GetTargetFps());
+
+    if (targetFps != framePacer.GetTargetFps())
+    {
+        framePacer.SetTargetFps(targetFps);
+    }
+
+    sFramePacerStats const& stats = framePacer.GetLastStats();
+
+    g_theDevConsole->AddLine(DevConsole::INFO_MINOR, Stringf("Target %.1f fps, %u frames: avg %.2f ms, p50 %.2f / p95 %.2f / p99 %.2f ms, max %.2f ms, %u missed",
+                                                             framePacer.GetTargetFps(), stats.m_frameCount, stats.m_averageMs,
+                                                             stats.m_p50Ms, stats.m_p95Ms, stats.m_p99Ms, stats.m_maxMs, stats.m_missedDeadlines));
+    return true;
+}
+
 //----------------------------------------------------------------------------------------------------
 STATIC void App::RequestQuit()
 {
@@ -239,6 +329,8 @@ STATIC void App::RequestQuit()
 //----------------------------------------------------------------------------------------------------
 void App::BeginFrame() const
 {
+    PROFILE_SCOPE("App::BeginFrame");
+
     g_theEventSystem->BeginFrame();
     g_theWindow->BeginFrame();
     g_theRenderer->BeginFrame();
@@ -252,10 +344,13 @@ void App::BeginFrame() const
 //----------------------------------------------------------------------------------------------------
 void App::Update()
 {
+    PROFILE_SCOPE("App::Update");
+
     Clock::TickSystemClock();
     float deltaSeconds = Clock::GetSystemClock().GetDeltaSeconds();
     UpdateCursorMode();
     g_theGame->Update();
+    UpdatePowerPolicy();
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -267,6 +362,14 @@ void App::Update()
 //
 void App::Render() const
 {
+    PROFILE_SCOPE("App::Render");
+
+    // 靜態畫面略過重繪時也不呈現（EndFrame），視窗保留上一次呈現的內容
+    if (!m_powerPolicy.ShouldRender())
+    {
+        return;
+    }
+
     Rgba8 const clearColor = Rgba8::GREY;
 
     g_theRenderer->ClearScreen(clearColor, Rgba8::BLACK);
@@ -280,9 +383,14 @@ void App::Render() const
 //----------------------------------------------------------------------------------------------------
 void App::EndFrame() const
 {
+    PROFILE_SCOPE("App::EndFrame");
+
     g_theEventSystem->EndFrame();
     g_theWindow->EndFrame();
-    g_theRenderer->EndFrame();
+    if (m_powerPolicy.ShouldRender())
+    {
+        g_theRenderer->EndFrame();
+    }
     DebugRenderEndFrame();
     g_theDevConsole->EndFrame();
     g_theInput->EndFrame();
@@ -306,6 +414,30 @@ void App::UpdateCursorMode()
     }
 }
 
+//----------------------------------------------------------------------------------------------------
+// 遊戲更新之後評估（展示模式可能在這一幀開始或結束）。等待被輸入喚醒的幀一定重繪，
+// 狀態改變時把新的幀率與腳本排程設定套用下去
+//----------------------------------------------------------------------------------------------------
+void App::UpdatePowerPolicy()
+{
+    bool const hasFocus      = GetActiveWindow() == g_theWindow->GetWindowHandle();
+    bool const isAttractMode = g_theGame->IsAttractMode();
+    bool const isSceneStatic = isAttractMode && !g_theDevConsole->IsOpen();
+
+    m_powerPolicy.Update(hasFocus, isAttractMode, isSceneStatic, m_framePacer.WasWokenByInput(), Clock::GetSystemClock().GetTotalSeconds());
+
+    if (!m_powerPolicy.HasStateChanged())
+    {
+        return;
+    }
+
+    sPowerStateSettings const& settings = m_powerPolicy.GetSettings();
+
+    m_framePacer.SetTargetFps(settings.m_targetFps);
+    m_framePacer.SetWakeOnInput(m_powerPolicy.ShouldWakeOnInput());
+    g_theGame->SetScriptSchedulerPaused(settings.m_isScriptPaused);
+}
+
 //----------------------------------------------------------------------------------------------------
 void App::DeleteAndCreateNewGame()
 {
@@ -326,7 +458,7 @@ void App::SetupScriptingBindings()
         g_theV8Subsystem->RegisterScriptableObject("game", m_gameScriptInterface);
 
         // 註冊一些實用的全域函式
-        g_theV8Subsystem->RegisterGlobalFunction("print", [](const std::vector<std::any>& args) -> std::any {
+        g_theV8Subsystem->RegisterGlobalFunction("print", ProfileScriptGlobal("print", [](const std::vector<std::any>& args) -> std::any {
             if (!args.empty())
             {
                 try
@@ -346,10 +478,10 @@ void App::SetupScriptingBindings()
                 }
             }
             return std::any{};
-        });
+        }));
 
         // 註冊除錯函式
-        g_theV8Subsystem->RegisterGlobalFunction("debug", [](const std::vector<std::any>& args) -> std::any {
+        g_theV8Subsystem->RegisterGlobalFunction("debug", ProfileScriptGlobal("debug", [](const std::vector<std::any>& args) -> std::any {
             if (!args.empty())
             {
                 try
@@ -363,10 +495,10 @@ void App::SetupScriptingBindings()
                 }
             }
             return std::any{};
-        });
+        }));
 
         // 註冊清理記憶體函式
-        g_theV8Subsystem->RegisterGlobalFunction("gc", [](const std::vector<std::any>& args) -> std::any {
+        g_theV8Subsystem->RegisterGlobalFunction("gc", ProfileScriptGlobal("gc", [](const std::vector<std::any>& args) -> std::any {
             UNUSED(args);
             if (g_theV8Subsystem)
             {
@@ -374,9 +506,12 @@ void App::SetupScriptingBindings()
                 DebuggerPrintf("JS: 垃圾回收已執行\n");
             }
             return std::any{};
-        });
+        }));
 
         DebuggerPrintf("腳本綁定設定完成！\n");
+
+        // 綁定完成後才載入函式庫，函式庫內可以直接使用 game / print 等全域物件
+        m_scriptLibrary.Load();
     }
     else
     {
@@ -5,7 +5,10 @@
 //----------------------------------------------------------------------------------------------------
 #pragma once
 #include "Engine/Core/EventSystem.hpp"
+#include "Game/Framework/FramePacer.hpp"
 #include "Game/Framework/GameScriptInterface.hpp"
+#include "Game/Framework/PowerPolicy.hpp"
+#include "Game/Framework/ScriptLibrary.hpp"
 
 //-Forward-Declaration--------------------------------------------------------------------------------
 class Camera;
@@ -23,9 +26,13 @@ public:
     void RunMainLoop();
 
     static bool OnCloseButtonClicked(EventArgs& args);
+    static bool OnFramePaceCommand(EventArgs& args);
     static void RequestQuit();
     static bool m_isQuitting;
 
+    FramePacer const&  GetFramePacer() const { return m_framePacer; }
+    PowerPolicy const& GetPowerPolicy() const { return m_powerPolicy; }
+
 private:
     void BeginFrame() const;
     void Update();
@@ -33,9 +40,14 @@ private:
     void EndFrame() const;
 
     void UpdateCursorMode();
+    void UpdatePowerPolicy();
     void DeleteAndCreateNewGame();
     void SetupScriptingBindings();
 
     Camera*                              m_devConsoleCamera = nullptr;
     std::shared_ptr<GameScriptInterface> m_gameScriptInterface;
+    ScriptLibrary                        m_scriptLibrary;
+    SystemFrameClock                     m_frameClock;
+    FramePacer                           m_framePacer{m_frameClock};
+    PowerPolicy                          m_powerPolicy;
 };
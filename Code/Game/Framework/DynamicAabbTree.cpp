@@ -0,0 +1,390 @@
+//----------------------------------------------------------------------------------------------------
+// DynamicAabbTree.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/DynamicAabbTree.hpp"
+
+#include <algorithm>
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    AABB3 GetUnion(AABB3 const& a, AABB3 const& b)
+    {
+        return AABB3(Vec3(std::min(a.m_mins.x, b.m_mins.x), std::min(a.m_mins.y, b.m_mins.y), std::min(a.m_mins.z, b.m_mins.z)),
+                     Vec3(std::max(a.m_maxs.x, b.m_maxs.x), std::max(a.m_maxs.y, b.m_maxs.y), std::max(a.m_maxs.z, b.m_maxs.z)));
+    }
+
+    //------------------------------------------------------------------------------------------------
+    float GetSurfaceArea(AABB3 const& bounds)
+    {
+        float const x = bounds.m_maxs.x - bounds.m_mins.x;
+        float const y = bounds.m_maxs.y - bounds.m_mins.y;
+        float const z = bounds.m_maxs.z - bounds.m_mins.z;
+
+        return 2.f * (x * y + y * z + z * x);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    bool IsContained(AABB3 const& outer, AABB3 const& inner)
+    {
+        return outer.m_mins.x <= inner.m_mins.x && outer.m_mins.y <= inner.m_mins.y && outer.m_mins.z <= inner.m_mins.z &&
+               outer.m_maxs.x >= inner.m_maxs.x && outer.m_maxs.y >= inner.m_maxs.y && outer.m_maxs.z >= inner.m_maxs.z;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    AABB3 GetFattened(AABB3 const& bounds, float const margin)
+    {
+        Vec3 const marginVector(margin, margin, margin);
+
+        return AABB3(bounds.m_mins - marginVector, bounds.m_maxs + marginVector);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+DynamicAabbTree::DynamicAabbTree(float const fatMargin)
+    : m_fatMargin(fatMargin)
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+int32_t DynamicAabbTree::CreateProxy(AABB3 const& bounds, uint32_t const userData)
+{
+    int32_t const proxyId = AllocateNode();
+
+    m_nodes[proxyId].m_bounds   = GetFattened(bounds, m_fatMargin);
+    m_nodes[proxyId].m_userData = userData;
+    m_nodes[proxyId].m_height   = 0;
+
+    InsertLeaf(proxyId);
+    ++m_proxyCount;
+
+    return proxyId;
+}
+
+//----------------------------------------------------------------------------------------------------
+void DynamicAabbTree::DestroyProxy(int32_t const proxyId)
+{
+    RemoveLeaf(proxyId);
+    FreeNode(proxyId);
+    --m_proxyCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+// 移出放大的盒子時移除再重新插入，而不是只擴大祖先：傳送到遠處的物件會讓祖先包圍盒變得很大，查詢效率變差
+//----------------------------------------------------------------------------------------------------
+bool DynamicAabbTree::MoveProxy(int32_t const proxyId, AABB3 const& bounds)
+{
+    if (IsContained(m_nodes[proxyId].m_bounds, bounds))
+    {
+        return false;
+    }
+
+    RemoveLeaf(proxyId);
+    m_nodes[proxyId].m_bounds = GetFattened(bounds, m_fatMargin);
+    InsertLeaf(proxyId);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void DynamicAabbTree::SetUserData(int32_t const proxyId, uint32_t const userData)
+{
+    m_nodes[proxyId].m_userData = userData;
+}
+
+//----------------------------------------------------------------------------------------------------
+void DynamicAabbTree::Clear()
+{
+    m_nodes.clear();
+    m_root       = NULL_NODE;
+    m_freeList   = NULL_NODE;
+    m_nodeCount  = 0;
+    m_proxyCount = 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool DynamicAabbTree::Validate() const
+{
+    if (m_root == NULL_NODE)
+    {
+        return m_nodeCount == 0;
+    }
+
+    return m_nodes[m_root].m_parent == NULL_NODE && ValidateNode(m_root);
+}
+
+//----------------------------------------------------------------------------------------------------
+int32_t DynamicAabbTree::AllocateNode()
+{
+    int32_t nodeId;
+
+    if (m_freeList != NULL_NODE)
+    {
+        nodeId     = m_freeList;
+        m_freeList = m_nodes[nodeId].m_parent;
+    }
+    else
+    {
+        nodeId = static_cast<int32_t>(m_nodes.size());
+        m_nodes.emplace_back();
+    }
+
+    m_nodes[nodeId] = sNode{};
+    ++m_nodeCount;
+
+    return nodeId;
+}
+
+//----------------------------------------------------------------------------------------------------
+void DynamicAabbTree::FreeNode(int32_t const nodeId)
+{
+    m_nodes[nodeId].m_parent = m_freeList;
+    m_nodes[nodeId].m_height = -1;
+    m_freeList               = nodeId;
+    --m_nodeCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+// 從根往下，每層比較「成為兄弟節點的成本」與「往子節點繼續下降的成本」，成本為新增的表面積：
+//   - 在此建立新父節點：合併後的面積 + 祖先因此增加的面積
+//   - 往子節點下降：子節點需擴大的面積（葉節點以合併後面積計）+ 祖先增加的面積
+//----------------------------------------------------------------------------------------------------
+void DynamicAabbTree::InsertLeaf(int32_t const leafId)
+{
+    if (m_root == NULL_NODE)
+    {
+        m_root                   = leafId;
+        m_nodes[leafId].m_parent = NULL_NODE;
+        return;
+    }
+
+    AABB3 const leafBounds = m_nodes[leafId].m_bounds;
+    int32_t     index      = m_root;
+
+    while (!m_nodes[index].IsLeaf())
+    {
+        int32_t const child1 = m_nodes[index].m_child1;
+        int32_t const child2 = m_nodes[index].m_child2;
+
+        float const area         = GetSurfaceArea(m_nodes[index].m_bounds);
+        float const combinedArea = GetSurfaceArea(GetUnion(m_nodes[index].m_bounds, leafBounds));
+
+        float const cost            = 2.f * combinedArea;
+        float const inheritanceCost = 2.f * (combinedArea - area);
+
+        auto const getDescendCost = [&](int32_t const child) {
+            float const childCombinedArea = GetSurfaceArea(GetUnion(leafBounds, m_nodes[child].m_bounds));
+
+            if (m_nodes[child].IsLeaf())
+            {
+                return childCombinedArea + inheritanceCost;
+            }
+
+            return childCombinedArea - GetSurfaceArea(m_nodes[child].m_bounds) + inheritanceCost;
+        };
+
+        float const cost1 = getDescendCost(child1);
+        float const cost2 = getDescendCost(child2);
+
+        if (cost < cost1 && cost < cost2)
+        {
+            break;
+        }
+
+        index = cost1 < cost2 ? child1 : child2;
+    }
+
+    int32_t const sibling   = index;
+    int32_t const oldParent = m_nodes[sibling].m_parent;
+    int32_t const newParent = AllocateNode();
+
+    m_nodes[newParent].m_parent = oldParent;
+    m_nodes[newParent].m_bounds = GetUnion(leafBounds, m_nodes[sibling].m_bounds);
+    m_nodes[newParent].m_height = m_nodes[sibling].m_height + 1;
+    m_nodes[newParent].m_child1 = sibling;
+    m_nodes[newParent].m_child2 = leafId;
+    m_nodes[sibling].m_parent   = newParent;
+    m_nodes[leafId].m_parent    = newParent;
+
+    if (oldParent == NULL_NODE)
+    {
+        m_root = newParent;
+    }
+    else if (m_nodes[oldParent].m_child1 == sibling)
+    {
+        m_nodes[oldParent].m_child1 = newParent;
+    }
+    else
+    {
+        m_nodes[oldParent].m_child2 = newParent;
+    }
+
+    RefitAncestors(m_nodes[leafId].m_parent);
+}
+
+//----------------------------------------------------------------------------------------------------
+// 葉節點的父節點被移除，兄弟節點接替父節點的位置
+//----------------------------------------------------------------------------------------------------
+void DynamicAabbTree::RemoveLeaf(int32_t const leafId)
+{
+    if (leafId == m_root)
+    {
+        m_root = NULL_NODE;
+        return;
+    }
+
+    int32_t const parent      = m_nodes[leafId].m_parent;
+    int32_t const grandParent = m_nodes[parent].m_parent;
+    int32_t const sibling     = m_nodes[parent].m_child1 == leafId ? m_nodes[parent].m_child2 : m_nodes[parent].m_child1;
+
+    if (grandParent == NULL_NODE)
+    {
+        m_root                    = sibling;
+        m_nodes[sibling].m_parent = NULL_NODE;
+        FreeNode(parent);
+        return;
+    }
+
+    if (m_nodes[grandParent].m_child1 == parent)
+    {
+        m_nodes[grandParent].m_child1 = sibling;
+    }
+    else
+    {
+        m_nodes[grandParent].m_child2 = sibling;
+    }
+
+    m_nodes[sibling].m_parent = grandParent;
+    FreeNode(parent);
+
+    RefitAncestors(grandParent);
+}
+
+//----------------------------------------------------------------------------------------------------
+// 由 nodeId 往上到根：先平衡，再以兩個子節點重新計算包圍盒與高度
+//----------------------------------------------------------------------------------------------------
+void DynamicAabbTree::RefitAncestors(int32_t nodeId)
+{
+    while (nodeId != NULL_NODE)
+    {
+        nodeId = Balance(nodeId);
+
+        sNode&       node   = m_nodes[nodeId];
+        sNode const& child1 = m_nodes[node.m_child1];
+        sNode const& child2 = m_nodes[node.m_child2];
+
+        node.m_height = 1 + std::max(child1.m_height, child2.m_height);
+        node.m_bounds = GetUnion(child1.m_bounds, child2.m_bounds);
+
+        nodeId = node.m_parent;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// 左右子樹高度差超過 1 時，把較高的子節點旋轉上來（與 AVL 樹相同），回傳旋轉後位於原位置的節點
+//----------------------------------------------------------------------------------------------------
+int32_t DynamicAabbTree::Balance(int32_t const nodeA)
+{
+    sNode& a = m_nodes[nodeA];
+
+    if (a.IsLeaf() || a.m_height < 2)
+    {
+        return nodeA;
+    }
+
+    int32_t const nodeB   = a.m_child1;
+    int32_t const nodeC   = a.m_child2;
+    int32_t const balance = m_nodes[nodeC].m_height - m_nodes[nodeB].m_height;
+
+    if (balance >= -1 && balance <= 1)
+    {
+        return nodeA;
+    }
+
+    // 較高的子節點 up 取代 A，A 成為 up 的子節點，up 較低的孫節點交給 A
+    int32_t const nodeUp    = balance > 1 ? nodeC : nodeB;
+    int32_t const nodeStay  = balance > 1 ? nodeB : nodeC;
+    sNode&        up        = m_nodes[nodeUp];
+    int32_t const grandF    = up.m_child1;
+    int32_t const grandG    = up.m_child2;
+    sNode&        f         = m_nodes[grandF];
+    sNode&        g         = m_nodes[grandG];
+    sNode const&  stay      = m_nodes[nodeStay];
+    int32_t const oldParent = a.m_parent;
+
+    up.m_child1 = nodeA;
+    up.m_parent = oldParent;
+    a.m_parent  = nodeUp;
+
+    if (oldParent == NULL_NODE)
+    {
+        m_root = nodeUp;
+    }
+    else if (m_nodes[oldParent].m_child1 == nodeA)
+    {
+        m_nodes[oldParent].m_child1 = nodeUp;
+    }
+    else
+    {
+        m_nodes[oldParent].m_child2 = nodeUp;
+    }
+
+    int32_t const keepId = f.m_height > g.m_height ? grandF : grandG;
+    int32_t const giveId = f.m_height > g.m_height ? grandG : grandF;
+    sNode&        keep   = m_nodes[keepId];
+    sNode&        give   = m_nodes[giveId];
+
+    up.m_child2 = keepId;
+
+    if (balance > 1)
+    {
+        a.m_child2 = giveId;
+    }
+    else
+    {
+        a.m_child1 = giveId;
+    }
+
+    give.m_parent = nodeA;
+
+    a.m_bounds  = GetUnion(stay.m_bounds, give.m_bounds);
+    up.m_bounds = GetUnion(a.m_bounds, keep.m_bounds);
+    a.m_height  = 1 + std::max(stay.m_height, give.m_height);
+    up.m_height = 1 + std::max(a.m_height, keep.m_height);
+
+    return nodeUp;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool DynamicAabbTree::ValidateNode(int32_t const nodeId) const
+{
+    sNode const& node = m_nodes[nodeId];
+
+    if (node.IsLeaf())
+    {
+        return node.m_child2 == NULL_NODE && node.m_height == 0;
+    }
+
+    sNode const& child1 = m_nodes[node.m_child1];
+    sNode const& child2 = m_nodes[node.m_child2];
+
+    if (child1.m_parent != nodeId || child2.m_parent != nodeId)
+    {
+        return false;
+    }
+
+    if (node.m_height != 1 + std::max(child1.m_height, child2.m_height))
+    {
+        return false;
+    }
+
+    if (!IsContained(node.m_bounds, child1.m_bounds) || !IsContained(node.m_bounds, child2.m_bounds))
+    {
+        return false;
+    }
+
+    return ValidateNode(node.m_child1) && ValidateNode(node.m_child2);
+}
@@ -0,0 +1,135 @@
+//----------------------------------------------------------------------------------------------------
+// DynamicAabbTree.hpp
+// 動態 AABB 樹（BVH）- 支援逐一插入、移除、移動的包圍盒階層，用於視錐剔除
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+#include "Engine/Math/AABB3.hpp"
+#include "Game/Framework/ViewFrustum.hpp"
+#include <cstdint>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+// 葉節點存放「放大過」的包圍盒（每邊外擴 fatMargin）：物件在放大的盒子內移動時不需更新樹。
+// 插入時以表面積啟發法（SAH）選擇兄弟節點，沿路往上重新計算祖先的包圍盒（refit）並做 AVL 式旋轉保持平衡。
+// 節點存在連續陣列中，釋放的節點串成空閒串列重複使用；proxy ID 就是葉節點索引，在 DestroyProxy 前保持不變。
+// 只依賴數學型別，可在沒有 Renderer 的環境中建立與查詢。
+//----------------------------------------------------------------------------------------------------
+class DynamicAabbTree
+{
+public:
+    static int32_t constexpr NULL_NODE = -1;
+
+    explicit DynamicAabbTree(float fatMargin = 0.5f);
+
+    int32_t  CreateProxy(AABB3 const& bounds, uint32_t userData);
+    void     DestroyProxy(int32_t proxyId);
+    bool     MoveProxy(int32_t proxyId, AABB3 const& bounds);   // 新的盒子仍在放大的盒子內時回傳 false，樹不變
+    void     SetUserData(int32_t proxyId, uint32_t userData);
+    uint32_t GetUserData(int32_t proxyId) const { return m_nodes[proxyId].m_userData; }
+    void     Clear();
+
+    AABB3 const& GetFatBounds(int32_t proxyId) const { return m_nodes[proxyId].m_bounds; }
+
+    // onVisible(userData) 對每個與視錐相交或在視錐內的葉節點呼叫一次；完全在視錐內的子樹不再測試平面
+    template <typename Callback>
+    void QueryFrustum(ViewFrustum const& frustum, Callback const& onVisible) const;
+
+    int32_t GetProxyCount() const { return m_proxyCount; }
+    int32_t GetNodeCount() const { return m_nodeCount; }
+    int32_t GetHeight() const { return m_root == NULL_NODE ? 0 : m_nodes[m_root].m_height; }
+    bool    Validate() const;   // 檢查父子連結、高度與包圍盒包含關係（除錯用）
+
+private:
+    struct sNode
+    {
+        AABB3    m_bounds;
+        int32_t  m_parent   = NULL_NODE;   // 空閒節點時為空閒串列的下一個
+        int32_t  m_child1   = NULL_NODE;
+        int32_t  m_child2   = NULL_NODE;
+        int32_t  m_height   = -1;          // 葉節點 0，空閒節點 -1
+        uint32_t m_userData = 0;
+
+        bool IsLeaf() const { return m_child1 == NULL_NODE; }
+    };
+
+    int32_t AllocateNode();
+    void    FreeNode(int32_t nodeId);
+    void    InsertLeaf(int32_t leafId);
+    void    RemoveLeaf(int32_t leafId);
+    void    RefitAncestors(int32_t nodeId);
+    int32_t Balance(int32_t nodeId);
+    bool    ValidateNode(int32_t nodeId) const;
+
+    template <typename Callback>
+    void ReportSubtree(int32_t nodeId, std::vector<int32_t>& stack, Callback const& onVisible) const;
+
+    std::vector<sNode> m_nodes;
+    int32_t            m_root       = NULL_NODE;
+    int32_t            m_freeList   = NULL_NODE;
+    int32_t            m_nodeCount  = 0;
+    int32_t            m_proxyCount = 0;
+    float              m_fatMargin  = 0.5f;
+};
+
+//----------------------------------------------------------------------------------------------------
+// 以明確的堆疊走訪，避免遞迴；INSIDE 的節點直接列出整個子樹
+//----------------------------------------------------------------------------------------------------
+template <typename Callback>
+void DynamicAabbTree::QueryFrustum(ViewFrustum const& frustum, Callback const& onVisible) const
+{
+    if (m_root == NULL_NODE)
+    {
+        return;
+    }
+
+    std::vector<int32_t> stack;
+    std::vector<int32_t> subtreeStack;
+    stack.reserve(64);
+    stack.push_back(m_root);
+
+    while (!stack.empty())
+    {
+        int32_t const nodeId = stack.back();
+        stack.pop_back();
+
+        sNode const&      node   = m_nodes[nodeId];
+        eCullResult const result = frustum.TestAabb(node.m_bounds);
+
+        if (result == eCullResult::OUTSIDE)
+        {
+            continue;
+        }
+
+        if (result == eCullResult::INSIDE || node.IsLeaf())
+        {
+            ReportSubtree(nodeId, subtreeStack, onVisible);
+            continue;
+        }
+
+        stack.push_back(node.m_child1);
+        stack.push_back(node.m_child2);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename Callback>
+void DynamicAabbTree::ReportSubtree(int32_t const nodeId, std::vector<int32_t>& stack, Callback const& onVisible) const
+{
+    stack.push_back(nodeId);
+
+    while (!stack.empty())
+    {
+        sNode const& node = m_nodes[stack.back()];
+        stack.pop_back();
+
+        if (node.IsLeaf())
+        {
+            onVisible(node.m_userData);
+            continue;
+        }
+
+        stack.push_back(node.m_child1);
+        stack.push_back(node.m_child2);
+    }
+}
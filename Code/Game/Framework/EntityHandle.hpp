@@ -0,0 +1,31 @@
+//----------------------------------------------------------------------------------------------------
+// EntityHandle.hpp
+// 32-bit 世代式控制代碼 - 低 20 位元為 slot 索引，高 12 位元為世代
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+#include <cstdint>
+
+//----------------------------------------------------------------------------------------------------
+// slot 被釋放時世代加一，舊的控制代碼因世代不符而失效。
+// 世代從 1 開始（回繞時跳過 0），因此數值 0 永遠代表無效的控制代碼。
+// 以數值形式交給腳本（JavaScript number 可精確表示 32-bit 整數）。
+//----------------------------------------------------------------------------------------------------
+struct sEntityHandle
+{
+    static uint32_t constexpr INDEX_BITS      = 20;
+    static uint32_t constexpr INDEX_MASK      = (1u << INDEX_BITS) - 1;
+    static uint32_t constexpr MAX_SLOT_COUNT  = INDEX_MASK + 1;
+    static uint32_t constexpr GENERATION_MASK = (1u << (32 - INDEX_BITS)) - 1;
+
+    uint32_t m_value = 0;
+
+    static sEntityHandle Make(uint32_t const index, uint32_t const generation) { return {(generation << INDEX_BITS) | index}; }
+
+    uint32_t GetIndex() const { return m_value & INDEX_MASK; }
+    uint32_t GetGeneration() const { return m_value >> INDEX_BITS; }
+    bool     IsValid() const { return m_value != 0; }
+
+    bool operator==(sEntityHandle const& other) const { return m_value == other.m_value; }
+    bool operator!=(sEntityHandle const& other) const { return m_value != other.m_value; }
+};
@@ -0,0 +1,58 @@
+//----------------------------------------------------------------------------------------------------
+// FixedTimestep.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/FixedTimestep.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+//----------------------------------------------------------------------------------------------------
+FixedTimestep::FixedTimestep(sFixedTimestepConfig const& config)
+    : m_config(config)
+{
+    m_config.m_stepSeconds      = std::max(m_config.m_stepSeconds, 0.0001);
+    m_config.m_maxStepsPerFrame = std::max(m_config.m_maxStepsPerFrame, 1u);
+}
+
+//----------------------------------------------------------------------------------------------------
+// 負的幀時間（時鐘重設）視為 0；達到步數上限時只保留不足一步的餘數
+//----------------------------------------------------------------------------------------------------
+uint32_t FixedTimestep::Advance(double const deltaSeconds)
+{
+    m_accumulatorSeconds += std::max(deltaSeconds, 0.0);
+
+    uint32_t stepCount = 0;
+
+    while (m_accumulatorSeconds >= m_config.m_stepSeconds && stepCount < m_config.m_maxStepsPerFrame)
+    {
+        m_accumulatorSeconds -= m_config.m_stepSeconds;
+        ++stepCount;
+    }
+
+    if (m_accumulatorSeconds >= m_config.m_stepSeconds)
+    {
+        double const keptSeconds = std::fmod(m_accumulatorSeconds, m_config.m_stepSeconds);
+
+        m_droppedSeconds += m_accumulatorSeconds - keptSeconds;
+        m_accumulatorSeconds = keptSeconds;
+    }
+
+    m_lastStepCount = stepCount;
+    return stepCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+void FixedTimestep::Reset()
+{
+    m_accumulatorSeconds = 0.0;
+    m_droppedSeconds     = 0.0;
+    m_lastStepCount      = 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+float FixedTimestep::GetAlpha() const
+{
+    return static_cast<float>(std::clamp(m_accumulatorSeconds / m_config.m_stepSeconds, 0.0, 1.0));
+}
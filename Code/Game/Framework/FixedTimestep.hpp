@@ -0,0 +1,39 @@
+//----------------------------------------------------------------------------------------------------
+// FixedTimestep.hpp
+// 固定時間步長累加器 - 把可變的幀時間換算成固定步長的模擬步數，並提供繪製用的內插比例
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+#include <cstdint>
+
+//----------------------------------------------------------------------------------------------------
+struct sFixedTimestepConfig
+{
+    double   m_stepSeconds      = 1.0 / 60.0;
+    uint32_t m_maxStepsPerFrame = 5;   // 超過的累積時間直接捨棄，避免模擬越落後、每幀要補的步數越多（spiral of death）
+};
+
+//----------------------------------------------------------------------------------------------------
+// 每幀呼叫一次 Advance，執行回傳的步數（每步 GetStepSeconds 秒），之後以 GetAlpha 在
+// 「最後一步之前」與「最後一步之後」的狀態之間內插繪製。
+//----------------------------------------------------------------------------------------------------
+class FixedTimestep
+{
+public:
+    explicit FixedTimestep(sFixedTimestepConfig const& config = {});
+
+    uint32_t Advance(double deltaSeconds);
+    void     Reset();
+
+    float    GetStepSeconds() const { return static_cast<float>(m_config.m_stepSeconds); }
+    float    GetAlpha() const;
+    uint32_t GetLastStepCount() const { return m_lastStepCount; }
+    uint32_t GetMaxStepsPerFrame() const { return m_config.m_maxStepsPerFrame; }
+    double   GetDroppedSeconds() const { return m_droppedSeconds; }   // 因步數上限而捨棄的累計時間
+
+private:
+    sFixedTimestepConfig m_config;
+    double               m_accumulatorSeconds = 0.0;
+    double               m_droppedSeconds     = 0.0;
+    uint32_t             m_lastStepCount      = 0;
+};
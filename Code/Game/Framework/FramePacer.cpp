@@ -0,0 +1,220 @@
+//----------------------------------------------------------------------------------------------------
+// FramePacer.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/FramePacer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <timeapi.h>
+
+//----------------------------------------------------------------------------------------------------
+SystemFrameClock::SystemFrameClock()
+{
+    timeBeginPeriod(1);
+}
+
+//----------------------------------------------------------------------------------------------------
+SystemFrameClock::~SystemFrameClock()
+{
+    timeEndPeriod(1);
+}
+
+//----------------------------------------------------------------------------------------------------
+uint64_t SystemFrameClock::GetTimeNs() const
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+//----------------------------------------------------------------------------------------------------
+// Sleep 以毫秒為單位，不足 1 ms 時只讓出剩餘的時間片。
+// MWMO_INPUTAVAILABLE 讓佇列中已有（但尚未處理）的輸入也能立即喚醒
+//----------------------------------------------------------------------------------------------------
+bool SystemFrameClock::SleepForNs(uint64_t const sleepNs, bool const wakeOnInput)
+{
+    DWORD const sleepMs = static_cast<DWORD>(sleepNs / 1000000);
+
+    if (!wakeOnInput)
+    {
+        Sleep(sleepMs);
+        return false;
+    }
+
+    return MsgWaitForMultipleObjectsEx(0, nullptr, sleepMs, QS_ALLINPUT, MWMO_INPUTAVAILABLE) == WAIT_OBJECT_0;
+}
+
+//----------------------------------------------------------------------------------------------------
+void SystemFrameClock::SpinWait()
+{
+    std::this_thread::yield();
+}
+
+//----------------------------------------------------------------------------------------------------
+bool ManualFrameClock::SleepForNs(uint64_t const sleepNs, bool const wakeOnInput)
+{
+    ++m_sleepCount;
+
+    if (wakeOnInput && m_hasPendingInput)
+    {
+        m_hasPendingInput = false;
+        return true;
+    }
+
+    m_timeNs += sleepNs + m_sleepOvershootNs;
+    return false;
+}
+
+//----------------------------------------------------------------------------------------------------
+void ManualFrameClock::SpinWait()
+{
+    m_timeNs += m_spinStepNs;
+    ++m_spinCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+FramePacer::FramePacer(IFrameClock& clock, sFramePacerConfig const& config)
+    : m_clock(clock),
+      m_config(config)
+{
+    m_config.m_statsWindowFrames = std::max(m_config.m_statsWindowFrames, 1u);
+    SetTargetFps(m_config.m_targetFps);
+}
+
+//----------------------------------------------------------------------------------------------------
+void FramePacer::WaitForNextFrame()
+{
+    m_wasWokenByInput = false;
+
+    if (m_periodNs > 0)
+    {
+        uint64_t const nowNs = m_clock.GetTimeNs();
+
+        if (m_nextDeadlineNs == 0 || nowNs >= m_nextDeadlineNs + m_periodNs)
+        {
+            if (m_nextDeadlineNs != 0)
+            {
+                ++m_windowMissedDeadlines;
+            }
+
+            m_nextDeadlineNs = nowNs;
+        }
+        else if (WaitUntil(m_nextDeadlineNs))
+        {
+            m_wasWokenByInput = true;
+            m_nextDeadlineNs  = m_clock.GetTimeNs();
+        }
+
+        m_nextDeadlineNs += m_periodNs;
+    }
+
+    RecordFrame(m_clock.GetTimeNs());
+}
+
+//----------------------------------------------------------------------------------------------------
+// 重新設定後從下一幀開始以新的間隔對齊
+//----------------------------------------------------------------------------------------------------
+void FramePacer::SetTargetFps(float const targetFps)
+{
+    m_config.m_targetFps = std::max(targetFps, 0.f);
+    m_periodNs           = m_config.m_targetFps > 0.f ? static_cast<uint64_t>(1000000000.0 / static_cast<double>(m_config.m_targetFps)) : 0;
+    m_nextDeadlineNs     = 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+// 回傳是否因輸入提早結束等待
+//----------------------------------------------------------------------------------------------------
+bool FramePacer::WaitUntil(uint64_t const deadlineNs)
+{
+    uint64_t const configSpinNs = static_cast<uint64_t>(std::max(m_config.m_spinWindowSeconds, 0.f) * 1000000000.f);
+
+    for (uint64_t nowNs = m_clock.GetTimeNs(); nowNs < deadlineNs; nowNs = m_clock.GetTimeNs())
+    {
+        uint64_t const remainingNs  = deadlineNs - nowNs;
+        uint64_t const spinWindowNs = std::max(configSpinNs, m_sleepOvershootNs);
+
+        if (remainingNs <= spinWindowNs)
+        {
+            m_clock.SpinWait();
+            continue;
+        }
+
+        uint64_t const requestedNs = remainingNs - spinWindowNs;
+
+        if (m_clock.SleepForNs(requestedNs, m_wakeOnInput))
+        {
+            return true;
+        }
+
+        // 觀察到的睡過頭時間立即採用，之後每次睡眠衰減 1/16，但不超過一整幀
+        uint64_t const sleptNs     = m_clock.GetTimeNs() - nowNs;
+        uint64_t const overshootNs = sleptNs > requestedNs ? sleptNs - requestedNs : 0;
+
+        m_sleepOvershootNs = std::min(std::max(overshootNs, m_sleepOvershootNs - m_sleepOvershootNs / 16), m_periodNs);
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------------------------------
+void FramePacer::RecordFrame(uint64_t const frameEndNs)
+{
+    if (m_lastFrameEndNs != 0 && frameEndNs > m_lastFrameEndNs)
+    {
+        uint64_t const frameNs     = frameEndNs - m_lastFrameEndNs;
+        uint64_t const bucketIndex = std::min<uint64_t>(frameNs / HISTOGRAM_BUCKET_NS, HISTOGRAM_BUCKET_COUNT - 1);
+
+        ++m_histogram[bucketIndex];
+        ++m_windowFrameCount;
+        m_windowTotalNs += frameNs;
+        m_windowMaxNs = std::max(m_windowMaxNs, frameNs);
+
+        if (m_windowFrameCount >= m_config.m_statsWindowFrames)
+        {
+            PublishStats();
+        }
+    }
+
+    m_lastFrameEndNs = frameEndNs;
+}
+
+//----------------------------------------------------------------------------------------------------
+void FramePacer::PublishStats()
+{
+    m_lastStats.m_frameCount      = m_windowFrameCount;
+    m_lastStats.m_missedDeadlines = m_windowMissedDeadlines;
+    m_lastStats.m_averageMs       = static_cast<float>(static_cast<double>(m_windowTotalNs) / static_cast<double>(m_windowFrameCount) / 1000000.0);
+    m_lastStats.m_p50Ms           = GetPercentileMs(0.50f);
+    m_lastStats.m_p95Ms           = GetPercentileMs(0.95f);
+    m_lastStats.m_p99Ms           = GetPercentileMs(0.99f);
+    m_lastStats.m_maxMs           = static_cast<float>(static_cast<double>(m_windowMaxNs) / 1000000.0);
+
+    m_histogram.fill(0);
+    m_windowFrameCount      = 0;
+    m_windowMissedDeadlines = 0;
+    m_windowTotalNs         = 0;
+    m_windowMaxNs           = 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+float FramePacer::GetPercentileMs(float const percentile) const
+{
+    uint32_t const targetCount = std::max(static_cast<uint32_t>(std::ceil(percentile * static_cast<float>(m_windowFrameCount))), 1u);
+    uint32_t       cumulative  = 0;
+
+    for (uint32_t bucketIndex = 0; bucketIndex < HISTOGRAM_BUCKET_COUNT; ++bucketIndex)
+    {
+        cumulative += m_histogram[bucketIndex];
+
+        if (cumulative >= targetCount)
+        {
+            return static_cast<float>(static_cast<double>((bucketIndex + 1) * HISTOGRAM_BUCKET_NS) / 1000000.0);
+        }
+    }
+
+    return static_cast<float>(static_cast<double>(HISTOGRAM_BUCKET_COUNT * HISTOGRAM_BUCKET_NS) / 1000000.0);
+}
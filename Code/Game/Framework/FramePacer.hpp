@@ -0,0 +1,131 @@
+//----------------------------------------------------------------------------------------------------
+// FramePacer.hpp
+// 幀率限制器 - 以固定間隔的截止時間配速（睡眠後自旋等待），並統計幀時間的 p50 / p95 / p99
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+#include <array>
+#include <cstdint>
+
+//----------------------------------------------------------------------------------------------------
+// FramePacer 的時間來源；替換成 ManualFrameClock 即可在沒有真實時間的情況下驗證配速邏輯
+//----------------------------------------------------------------------------------------------------
+class IFrameClock
+{
+public:
+    virtual ~IFrameClock() = default;
+
+    virtual uint64_t GetTimeNs() const                              = 0;
+    virtual bool     SleepForNs(uint64_t sleepNs, bool wakeOnInput) = 0;   // 可能睡過頭；只有 wakeOnInput 時會因輸入提早醒來並回傳 true
+    virtual void     SpinWait()                                     = 0;   // 自旋等待中的一次讓步
+};
+
+//----------------------------------------------------------------------------------------------------
+// steady_clock 與 Win32 Sleep；存在期間把系統計時器解析度提高到 1 ms，讓短暫睡眠不會多睡一整個排程週期。
+// wakeOnInput 時改以 MsgWaitForMultipleObjectsEx 等待，執行緒的訊息佇列有輸入就醒來
+//----------------------------------------------------------------------------------------------------
+class SystemFrameClock : public IFrameClock
+{
+public:
+    SystemFrameClock();
+    ~SystemFrameClock() override;
+
+    SystemFrameClock(SystemFrameClock const&)            = delete;
+    SystemFrameClock& operator=(SystemFrameClock const&) = delete;
+
+    uint64_t GetTimeNs() const override;
+    bool     SleepForNs(uint64_t sleepNs, bool wakeOnInput) override;
+    void     SpinWait() override;
+};
+
+//----------------------------------------------------------------------------------------------------
+// 手動推進的時鐘：SleepForNs 推進要求的時間再加上 m_sleepOvershootNs，SpinWait 推進 m_spinStepNs；
+// m_hasPendingInput 模擬等待期間的輸入（被可喚醒的睡眠取走時不推進時間）
+//----------------------------------------------------------------------------------------------------
+class ManualFrameClock : public IFrameClock
+{
+public:
+    uint64_t GetTimeNs() const override { return m_timeNs; }
+    bool     SleepForNs(uint64_t sleepNs, bool wakeOnInput) override;
+    void     SpinWait() override;
+
+    void AdvanceNs(uint64_t deltaNs) { m_timeNs += deltaNs; }
+
+    uint64_t m_timeNs           = 0;
+    uint64_t m_sleepOvershootNs = 0;
+    uint64_t m_spinStepNs       = 1000;
+    uint32_t m_sleepCount       = 0;
+    uint32_t m_spinCount        = 0;
+    bool     m_hasPendingInput  = false;
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sFramePacerConfig
+{
+    float    m_targetFps         = 60.f;     // 0 表示不限制（仍統計幀時間）
+    float    m_spinWindowSeconds = 0.002f;   // 截止時間前最後這段時間只自旋，不睡眠
+    uint32_t m_statsWindowFrames = 240;      // 每累積這麼多幀發布一次統計
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sFramePacerStats
+{
+    uint32_t m_frameCount      = 0;
+    uint32_t m_missedDeadlines = 0;   // 晚於截止時間超過一幀而重新對齊的次數
+    float    m_averageMs       = 0.f;
+    float    m_p50Ms           = 0.f;
+    float    m_p95Ms           = 0.f;
+    float    m_p99Ms           = 0.f;
+    float    m_maxMs           = 0.f;
+};
+
+//----------------------------------------------------------------------------------------------------
+// 每幀結束時呼叫 WaitForNextFrame。截止時間以「上一個截止時間 + 間隔」累加而不是「現在 + 間隔」，
+// 單幀的睡眠誤差不會累積成漂移；落後超過一整幀時才重新對齊到現在，避免之後連續不等待地追趕。
+//
+// 等待分兩段：距離截止時間還超過自旋視窗時睡眠，剩下的時間自旋。
+// 自旋視窗取設定值與實際觀察到的最大睡過頭時間（逐漸衰減）兩者中較大者。
+//
+// 幀時間以 0.25 ms 寬的直方圖累積（100 ms 以上併入最後一格），百分位數取所在格的上緣。
+//----------------------------------------------------------------------------------------------------
+class FramePacer
+{
+public:
+    explicit FramePacer(IFrameClock& clock, sFramePacerConfig const& config = {});
+
+    void WaitForNextFrame();
+
+    void  SetTargetFps(float targetFps);
+    float GetTargetFps() const { return m_config.m_targetFps; }
+
+    // 低幀率（閒置）時開啟：等待期間有輸入就結束等待，並從該時間點重新對齊截止時間
+    void SetWakeOnInput(bool wakeOnInput) { m_wakeOnInput = wakeOnInput; }
+    bool WasWokenByInput() const { return m_wasWokenByInput; }
+
+    sFramePacerStats const& GetLastStats() const { return m_lastStats; }
+
+private:
+    static uint32_t constexpr HISTOGRAM_BUCKET_COUNT = 400;
+    static uint64_t constexpr HISTOGRAM_BUCKET_NS    = 250000;
+
+    bool  WaitUntil(uint64_t deadlineNs);
+    void  RecordFrame(uint64_t frameEndNs);
+    void  PublishStats();
+    float GetPercentileMs(float percentile) const;
+
+    IFrameClock&      m_clock;
+    sFramePacerConfig m_config;
+    uint64_t          m_periodNs         = 0;
+    uint64_t          m_nextDeadlineNs   = 0;
+    uint64_t          m_lastFrameEndNs   = 0;
+    uint64_t          m_sleepOvershootNs = 0;
+    bool              m_wakeOnInput      = false;
+    bool              m_wasWokenByInput  = false;
+
+    std::array<uint32_t, HISTOGRAM_BUCKET_COUNT> m_histogram             = {};
+    uint32_t                                     m_windowFrameCount      = 0;
+    uint32_t                                     m_windowMissedDeadlines = 0;
+    uint64_t                                     m_windowTotalNs         = 0;
+    uint64_t                                     m_windowMaxNs           = 0;
+    sFramePacerStats                             m_lastStats;
+};
@@ -0,0 +1,326 @@
+//----------------------------------------------------------------------------------------------------
+// FrameProfiler.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/FrameProfiler.hpp"
+
+#include "Engine/Core/DevConsole.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <memory>
+#include <mutex>
+
+//----------------------------------------------------------------------------------------------------
+struct sProfilerThreadBuffer
+{
+    static uint32_t constexpr CAPACITY    = 1u << 14;
+    static uint32_t constexpr SAFE_MARGIN = 64;   // 讀取時略過的最舊樣本數（寫入端可能正在覆寫）
+
+    std::array<sProfileSample, CAPACITY> m_samples;
+    std::atomic<uint64_t>                m_writeCount  = 0;
+    uint32_t                             m_threadIndex = 0;
+    uint32_t                             m_depth       = 0;   // 只由擁有者執行緒存取
+    std::string                          m_threadName;
+};
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    // 緩衝區在程式結束前不釋放，執行緒結束後仍可輸出它記錄的樣本
+    std::mutex                                           s_registryMutex;
+    std::vector<std::unique_ptr<sProfilerThreadBuffer>>* s_registry = nullptr;
+
+    // 以下只在主執行緒（呼叫 BeginFrame 的執行緒）存取
+    sProfilerThreadBuffer* s_mainThreadBuffer    = nullptr;
+    uint64_t               s_currentFrameBeginNs = 0;
+    uint64_t               s_lastFrameBeginNs    = 0;
+    uint64_t               s_lastFrameEndNs      = 0;
+
+    thread_local sProfilerThreadBuffer* t_threadBuffer = nullptr;
+
+    //------------------------------------------------------------------------------------------------
+    void AppendJsonEscaped(std::string& out, char const* text)
+    {
+        for (char const* c = text; c && *c; ++c)
+        {
+            if (*c == '"' || *c == '\\')
+            {
+                out += '\\';
+            }
+            out += *c;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC void FrameProfiler::BeginFrame()
+{
+    uint64_t const nowNs = GetTimeNs();
+
+    s_mainThreadBuffer    = &GetThreadBuffer();
+    s_lastFrameBeginNs    = s_currentFrameBeginNs;
+    s_lastFrameEndNs      = nowNs;
+    s_currentFrameBeginNs = nowNs;
+
+    if (s_mainThreadBuffer->m_threadName.empty())
+    {
+        SetThreadName("Main");
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC void FrameProfiler::SetThreadName(char const* threadName)
+{
+    sProfilerThreadBuffer& buffer = GetThreadBuffer();
+
+    std::lock_guard<std::mutex> const lock(s_registryMutex);
+    buffer.m_threadName = threadName ? threadName : "";
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC uint32_t FrameProfiler::PushScope()
+{
+    return GetThreadBuffer().m_depth++;
+}
+
+//----------------------------------------------------------------------------------------------------
+// 只有擁有者執行緒寫入樣本；寫完後以 release 發布新的寫入計數
+//----------------------------------------------------------------------------------------------------
+STATIC void FrameProfiler::PopScope(char const* name, uint64_t const beginNs, uint32_t const depth)
+{
+    uint64_t const         endNs  = GetTimeNs();
+    sProfilerThreadBuffer& buffer = GetThreadBuffer();
+    uint64_t const         count  = buffer.m_writeCount.load(std::memory_order_relaxed);
+
+    buffer.m_samples[count % sProfilerThreadBuffer::CAPACITY] = {name, beginNs, endNs, depth};
+    buffer.m_writeCount.store(count + 1, std::memory_order_release);
+    buffer.m_depth = depth;
+}
+
+//----------------------------------------------------------------------------------------------------
+// 主執行緒上完全落在上一幀範圍內的區塊，依首次出現的順序（即呼叫順序）合併同名、同層級的項目
+//----------------------------------------------------------------------------------------------------
+STATIC std::vector<sProfileFrameEntry> FrameProfiler::GetLastFrameEntries()
+{
+    std::vector<sProfileFrameEntry> entries;
+
+    if (!s_mainThreadBuffer || s_lastFrameBeginNs == 0)
+    {
+        return entries;
+    }
+
+    std::vector<sProfileSample> samples = CopyPublishedSamples(*s_mainThreadBuffer);
+
+    // 樣本依結束時間寫入，改依開始時間排序才會是父區塊在前
+    std::stable_sort(samples.begin(), samples.end(), [](sProfileSample const& a, sProfileSample const& b) {
+        return a.m_beginNs < b.m_beginNs;
+    });
+
+    for (sProfileSample const& sample : samples)
+    {
+        if (sample.m_beginNs < s_lastFrameBeginNs || sample.m_endNs > s_lastFrameEndNs)
+        {
+            continue;
+        }
+
+        auto const found = std::find_if(entries.begin(), entries.end(), [&sample](sProfileFrameEntry const& entry) {
+            return entry.m_name == sample.m_name && entry.m_depth == sample.m_depth;
+        });
+
+        sProfileFrameEntry& entry = found != entries.end() ? *found : entries.emplace_back(sProfileFrameEntry{sample.m_name, sample.m_depth});
+        ++entry.m_callCount;
+        entry.m_totalNs += sample.m_endNs - sample.m_beginNs;
+    }
+
+    return entries;
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC uint64_t FrameProfiler::GetLastFrameNs()
+{
+    return s_lastFrameBeginNs != 0 ? s_lastFrameEndNs - s_lastFrameBeginNs : 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC std::vector<std::string> FrameProfiler::BuildOverlayLines(size_t const maxLines)
+{
+    std::vector<std::string> lines;
+
+    lines.push_back(Stringf("Frame %.2f ms", static_cast<double>(GetLastFrameNs()) / 1000000.0));
+
+    for (sProfileFrameEntry const& entry : GetLastFrameEntries())
+    {
+        if (lines.size() >= maxLines)
+        {
+            break;
+        }
+
+        lines.push_back(Stringf("%*s%s %.3f ms (x%u)",
+                                static_cast<int>(entry.m_depth * 2), "",
+                                entry.m_name,
+                                static_cast<double>(entry.m_totalNs) / 1000000.0,
+                                entry.m_callCount));
+    }
+
+    return lines;
+}
+
+//----------------------------------------------------------------------------------------------------
+// 時間以微秒輸出，並以所有樣本中最早的開始時間為 0
+//----------------------------------------------------------------------------------------------------
+STATIC bool FrameProfiler::DumpChromeTrace(std::string const& filePath)
+{
+    struct sThreadSamples
+    {
+        uint32_t                    m_threadIndex = 0;
+        std::string                 m_threadName;
+        std::vector<sProfileSample> m_samples;
+    };
+
+    std::vector<sThreadSamples> threads;
+    uint64_t                    originNs = UINT64_MAX;
+
+    {
+        std::lock_guard<std::mutex> const lock(s_registryMutex);
+
+        if (s_registry)
+        {
+            for (std::unique_ptr<sProfilerThreadBuffer> const& buffer : *s_registry)
+            {
+                sThreadSamples& thread = threads.emplace_back();
+                thread.m_threadIndex   = buffer->m_threadIndex;
+                thread.m_threadName    = buffer->m_threadName;
+                thread.m_samples       = CopyPublishedSamples(*buffer);
+
+                for (sProfileSample const& sample : thread.m_samples)
+                {
+                    originNs = std::min(originNs, sample.m_beginNs);
+                }
+            }
+        }
+    }
+
+    std::ofstream file(filePath, std::ios::trunc);
+    if (!file)
+    {
+        return false;
+    }
+
+    std::string json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool        isFirstEvent = true;
+
+    auto beginEvent = [&json, &isFirstEvent]() {
+        json += isFirstEvent ? "" : ",\n";
+        isFirstEvent = false;
+    };
+
+    for (sThreadSamples const& thread : threads)
+    {
+        beginEvent();
+        json += Stringf("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"", thread.m_threadIndex);
+        AppendJsonEscaped(json, thread.m_threadName.empty() ? "Thread" : thread.m_threadName.c_str());
+        json += "\"}}";
+
+        for (sProfileSample const& sample : thread.m_samples)
+        {
+            beginEvent();
+            json += "{\"name\":\"";
+            AppendJsonEscaped(json, sample.m_name);
+            json += Stringf("\",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                            thread.m_threadIndex,
+                            static_cast<double>(sample.m_beginNs - originNs) / 1000.0,
+                            static_cast<double>(sample.m_endNs - sample.m_beginNs) / 1000.0);
+        }
+    }
+
+    json += "\n]}\n";
+    file << json;
+
+    return static_cast<bool>(file);
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC bool FrameProfiler::OnFrameProfileCommand(EventArgs& args)
+{
+    if (!g_theDevConsole)
+    {
+        return false;
+    }
+
+    std::string const enable   = args.GetValue("enable", std::string());
+    std::string const overlay  = args.GetValue("overlay", std::string());
+    std::string const dumpPath = args.GetValue("dump", std::string());
+
+    if (!enable.empty())
+    {
+        SetEnabled(enable == "true");
+        g_theDevConsole->AddLine(DevConsole::INFO_MINOR, IsEnabled() ? "Frame profiler enabled" : "Frame profiler disabled");
+    }
+
+    if (!overlay.empty())
+    {
+        SetOverlayVisible(overlay == "true");
+        g_theDevConsole->AddLine(DevConsole::INFO_MINOR, IsOverlayVisible() ? "Frame profiler overlay shown" : "Frame profiler overlay hidden");
+    }
+
+    if (!dumpPath.empty())
+    {
+        bool const success = DumpChromeTrace(dumpPath);
+        g_theDevConsole->AddLine(success ? DevConsole::INFO_MINOR : DevConsole::ERROR,
+                                 Stringf("%s frame trace to %s", success ? "Wrote" : "Failed to write", dumpPath.c_str()));
+    }
+
+    if (!enable.empty() || !overlay.empty() || !dumpPath.empty())
+    {
+        return true;
+    }
+
+    for (std::string const& line : BuildOverlayLines(64))
+    {
+        g_theDevConsole->AddLine(DevConsole::INFO_MINOR, line);
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC sProfilerThreadBuffer& FrameProfiler::GetThreadBuffer()
+{
+    if (!t_threadBuffer)
+    {
+        std::lock_guard<std::mutex> const lock(s_registryMutex);
+
+        if (!s_registry)
+        {
+            s_registry = new std::vector<std::unique_ptr<sProfilerThreadBuffer>>();
+        }
+
+        std::unique_ptr<sProfilerThreadBuffer>& buffer = s_registry->emplace_back(std::make_unique<sProfilerThreadBuffer>());
+
+        buffer->m_threadIndex = static_cast<uint32_t>(s_registry->size());
+        t_threadBuffer        = buffer.get();
+    }
+
+    return *t_threadBuffer;
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC std::vector<sProfileSample> FrameProfiler::CopyPublishedSamples(sProfilerThreadBuffer const& buffer)
+{
+    uint64_t const writeCount = buffer.m_writeCount.load(std::memory_order_acquire);
+    uint64_t const firstIndex = writeCount > sProfilerThreadBuffer::CAPACITY ? writeCount - sProfilerThreadBuffer::CAPACITY + sProfilerThreadBuffer::SAFE_MARGIN : 0;
+
+    std::vector<sProfileSample> samples;
+    samples.reserve(static_cast<size_t>(writeCount - firstIndex));
+
+    for (uint64_t index = firstIndex; index < writeCount; ++index)
+    {
+        samples.push_back(buffer.m_samples[index % sProfilerThreadBuffer::CAPACITY]);
+    }
+
+    return samples;
+}
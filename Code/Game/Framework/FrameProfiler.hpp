@@ -0,0 +1,122 @@
+//----------------------------------------------------------------------------------------------------
+// FrameProfiler.hpp
+// 階層式幀分析器 - 以區塊計時標記記錄 CPU 時間，每個執行緒寫入自己的無鎖環狀緩衝區，可輸出 Chrome trace JSON
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+#include "Engine/Core/EventSystem.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+struct sProfilerThreadBuffer;
+
+//----------------------------------------------------------------------------------------------------
+struct sProfileSample
+{
+    char const* m_name    = nullptr;   // 必須是字串常值（只保存指標）
+    uint64_t    m_beginNs = 0;
+    uint64_t    m_endNs   = 0;
+    uint32_t    m_depth   = 0;         // 同一執行緒上的巢狀層級，0 為最外層
+};
+
+//----------------------------------------------------------------------------------------------------
+// 上一個完整幀中，同名、同層級區塊的累計時間
+//----------------------------------------------------------------------------------------------------
+struct sProfileFrameEntry
+{
+    char const* m_name      = nullptr;
+    uint32_t    m_depth     = 0;
+    uint32_t    m_callCount = 0;
+    uint64_t    m_totalNs   = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// 執行緒第一次記錄時配置自己的環狀緩衝區（只有此時需要鎖），之後寫入只有該執行緒本身，
+// 以 atomic 寫入計數發布；讀取端（主執行緒的 overlay 與 dump）只讀取已發布的樣本。
+// 緩衝區寫滿後覆寫最舊的樣本，讀取時略過最舊的一小段以避開正在被覆寫的位置。
+//
+// 停用時 PROFILE_SCOPE 只做一次 atomic 讀取，不讀時間。
+// 不依賴視窗或 Renderer，無頭（headless）執行模擬時同樣可用，只需呼叫 BeginFrame 與 DumpChromeTrace。
+//
+// DevConsole 指令：
+//   FrameProfile enable=true       開始 / 停止（enable=false）記錄
+//   FrameProfile overlay=true      顯示 / 隱藏（overlay=false）上一幀的區塊耗時
+//   FrameProfile dump=<path>       輸出 Chrome trace-event JSON（chrome://tracing 或 Perfetto 開啟）
+//----------------------------------------------------------------------------------------------------
+class FrameProfiler
+{
+public:
+    static bool IsEnabled() { return s_isEnabled.load(std::memory_order_relaxed); }
+    static void SetEnabled(bool isEnabled) { s_isEnabled.store(isEnabled, std::memory_order_relaxed); }
+    static bool IsOverlayVisible() { return s_isOverlayVisible; }
+    static void SetOverlayVisible(bool isVisible) { s_isOverlayVisible = isVisible; }
+
+    static uint64_t GetTimeNs();
+
+    // 主執行緒每幀開頭呼叫一次，標記上一幀的結束
+    static void BeginFrame();
+    static void SetThreadName(char const* threadName);
+
+    static uint32_t PushScope();
+    static void     PopScope(char const* name, uint64_t beginNs, uint32_t depth);
+
+    static std::vector<sProfileFrameEntry> GetLastFrameEntries();
+    static uint64_t                        GetLastFrameNs();
+    static std::vector<std::string>        BuildOverlayLines(size_t maxLines);
+    static bool                            DumpChromeTrace(std::string const& filePath);
+
+    static bool OnFrameProfileCommand(EventArgs& args);
+
+private:
+    static sProfilerThreadBuffer&      GetThreadBuffer();
+    static std::vector<sProfileSample> CopyPublishedSamples(sProfilerThreadBuffer const& buffer);
+
+    static inline std::atomic<bool> s_isEnabled       = false;
+    static inline bool              s_isOverlayVisible = false;
+};
+
+//----------------------------------------------------------------------------------------------------
+class ScopedProfileMarker
+{
+public:
+    explicit ScopedProfileMarker(char const* name)
+        : m_name(FrameProfiler::IsEnabled() ? name : nullptr)
+    {
+        if (m_name)
+        {
+            m_depth   = FrameProfiler::PushScope();
+            m_beginNs = FrameProfiler::GetTimeNs();
+        }
+    }
+
+    ~ScopedProfileMarker()
+    {
+        if (m_name)
+        {
+            FrameProfiler::PopScope(m_name, m_beginNs, m_depth);
+        }
+    }
+
+    ScopedProfileMarker(ScopedProfileMarker const&)            = delete;
+    ScopedProfileMarker& operator=(ScopedProfileMarker const&) = delete;
+
+private:
+    char const* m_name    = nullptr;
+    uint64_t    m_beginNs = 0;
+    uint32_t    m_depth   = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+#define PROFILE_SCOPE_CONCAT_INNER(a, b) a##b
+#define PROFILE_SCOPE_CONCAT(a, b)       PROFILE_SCOPE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(name)              ScopedProfileMarker PROFILE_SCOPE_CONCAT(profileScope_, __LINE__)(name)
+
+//----------------------------------------------------------------------------------------------------
+inline uint64_t FrameProfiler::GetTimeNs()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
@@ -12,6 +12,7 @@ class App;
 class AudioSystem;
 class BitmapFont;
 class Game;
+class JobSystem;
 class LightSubsystem;
 class Renderer;
 class RandomNumberGenerator;
@@ -22,6 +23,7 @@ extern App*                   g_theApp;
 extern AudioSystem*           g_theAudio;
 extern BitmapFont*            g_theBitmapFont;
 extern Game*                  g_theGame;
+extern JobSystem*             g_theJobSystem;
 extern Renderer*              g_theRenderer;
 extern RandomNumberGenerator* g_theRNG;
 extern LightSubsystem*        g_theLightSubsystem;
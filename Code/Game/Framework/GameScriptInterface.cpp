@@ -4,15 +4,81 @@
 //----------------------------------------------------------------------------------------------------
 
 #include "Game/Framework/GameScriptInterface.hpp"
+#include "Game/Framework/FrameProfiler.hpp"
+#include "Game/Framework/ScriptBinding.hpp"
 #include "Game/Game.hpp"
-#include "Game/Player.hpp"
-#include "Engine/Math/Vec3.hpp"
 #include "Engine/Core/ErrorWarningAssert.hpp"
-#include <stdexcept>
-#include <sstream>
+#include <cstring>
+#include <string_view>
 
 #include "Engine/Core/EngineCommon.hpp"
 
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    // 方法綁定表：每個 JavaScript 方法直接對應一個 Game 成員函式，
+    // 由 ScriptMethodBinder 在編譯期產生型別化的呼叫轉接器。
+    //------------------------------------------------------------------------------------------------
+    std::vector<sScriptMethodBinding<Game>> const& GetMethodBindings()
+    {
+        static std::vector<sScriptMethodBinding<Game>> const s_bindings = {
+            BindScriptMethod<&Game::CreateCube>("createCube", "在指定位置創建一個立方體，回傳其控制代碼"),
+            BindScriptMethod<&Game::CreateCubes>("createCubes", "以 Float32Array (x,y,z...) 一次創建多個立方體，可選 Uint8Array (r,g,b,a...) 顏色，回傳控制代碼的 Uint32Array", 1),
+            BindScriptMethod<&Game::MoveProp>("moveProp", "移動指定控制代碼的道具到新位置"),
+            BindScriptMethod<&Game::RemoveProp>("removeProp", "移除指定控制代碼的道具"),
+            BindScriptMethod<&Game::WritePropTransforms>("writeTransforms", "從 slot 起以 Float32Array 寫入連續道具的完整變換（每個 10 個 float）"),
+            BindScriptMethod<&Game::WritePropPositions>("writePositions", "從 slot 起以 Float32Array (x,y,z...) 寫入連續道具的位置"),
+            BindScriptMethod<&Game::MarkPropTransformsDirty>("markTransformsDirty", "標記直接寫入共用緩衝區的 slot 範圍，可選欄位遮罩（position 1、orientation 2、color 4）", 2),
+            BindScriptMethod<&Game::GetPlayerPosition>("getPlayerPosition", "取得玩家目前位置"),
+            BindScriptMethod<&Game::ExecuteJavaScriptCommand>("executeCommand", "執行 JavaScript 指令"),
+            BindScriptMethod<&Game::ExecuteJavaScriptFile>("executeFile", "執行 JavaScript 檔案"),
+            BindScriptMethod<&Game::IsAttractMode>("isAttractMode", "檢查遊戲是否處於吸引模式"),
+            BindScriptMethod<&Game::GetGameStateName>("getGameState", "取得目前遊戲狀態"),
+            BindScriptMethod<&Game::SetScriptTaskCount>("setScriptTaskCount", "（Scheduler.js 內部使用）回報待執行的排程任務數"),
+            BindScriptMethod<&Game::ReportScriptTaskOverBudget>("reportScriptTaskOverBudget", "（Scheduler.js 內部使用）回報單一步驟超出預算的任務"),
+        };
+        return s_bindings;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // 名稱查詢表在註冊時（GameScriptInterface 建構時）建立一次。IScriptableObject::CallMethod 每次只帶方法名稱，
+    // 無法在 V8 的回呼中直接保存索引，因此每次呼叫仍需比對名稱：先比長度再 memcmp，
+    // 綁定只有十幾個，比雜湊整個字串再查 unordered_map 便宜，也不配置記憶體。
+    //------------------------------------------------------------------------------------------------
+    struct sMethodNameEntry
+    {
+        std::string_view                  m_name;
+        sScriptMethodBinding<Game> const* m_binding = nullptr;
+    };
+
+    std::vector<sMethodNameEntry> const& GetMethodNameTable()
+    {
+        static std::vector<sMethodNameEntry> const s_table = [] {
+            std::vector<sMethodNameEntry> table;
+            for (sScriptMethodBinding<Game> const& binding : GetMethodBindings())
+            {
+                table.push_back({binding.m_name, &binding});
+            }
+            return table;
+        }();
+        return s_table;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    sScriptMethodBinding<Game> const* FindMethodBinding(std::string const& methodName)
+    {
+        for (sMethodNameEntry const& entry : GetMethodNameTable())
+        {
+            if (entry.m_name.size() == methodName.size() && std::memcmp(entry.m_name.data(), methodName.data(), methodName.size()) == 0)
+            {
+                return entry.m_binding;
+            }
+        }
+        return nullptr;
+    }
+}
+
 //----------------------------------------------------------------------------------------------------
 GameScriptInterface::GameScriptInterface(Game* game)
     : m_game(game)
@@ -21,6 +87,9 @@ GameScriptInterface::GameScriptInterface(Game* game)
     {
         ERROR_AND_DIE("GameScriptInterface: Game pointer cannot be null");
     }
+
+    // 在註冊前建立綁定表與名稱查詢表，第一次腳本呼叫不必付出建表成本
+    GetMethodNameTable();
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -32,42 +101,12 @@ std::string GameScriptInterface::GetScriptObjectName() const
 //----------------------------------------------------------------------------------------------------
 std::vector<ScriptMethodInfo> GameScriptInterface::GetAvailableMethods() const
 {
-    return {
-        ScriptMethodInfo("createCube",
-                        "在指定位置創建一個立方體",
-                        {"float", "float", "float"},
-                        "string"),
-
-        ScriptMethodInfo("moveProp",
-                        "移動指定索引的道具到新位置",
-                        {"int", "float", "float", "float"},
-                        "string"),
-
-        ScriptMethodInfo("getPlayerPosition",
-                        "取得玩家目前位置",
-                        {},
-                        "object"),
-
-        ScriptMethodInfo("executeCommand",
-                        "執行 JavaScript 指令",
-                        {"string"},
-                        "string"),
-
-        ScriptMethodInfo("executeFile",
-                        "執行 JavaScript 檔案",
-                        {"string"},
-                        "string"),
-
-        ScriptMethodInfo("isAttractMode",
-                        "檢查遊戲是否處於吸引模式",
-                        {},
-                        "bool"),
-
-        ScriptMethodInfo("getGameState",
-                        "取得目前遊戲狀態",
-                        {},
-                        "string")
-    };
+    std::vector<ScriptMethodInfo> methods;
+    for (sScriptMethodBinding<Game> const& binding : GetMethodBindings())
+    {
+        methods.emplace_back(binding.m_name, binding.m_description, binding.m_argTypes, binding.m_returnType);
+    }
+    return methods;
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -83,38 +122,27 @@ std::vector<std::string> GameScriptInterface::GetAvailableProperties() const
 ScriptMethodResult GameScriptInterface::CallMethod(const std::string& methodName,
                                                   const std::vector<std::any>& args)
 {
+    PROFILE_SCOPE("GameScriptInterface::CallMethod");
+
+    sScriptMethodBinding<Game> const* binding = FindMethodBinding(methodName);
+    if (!binding)
+    {
+        return ScriptMethodResult::Error("未知的方法: " + methodName);
+    }
+
     try
     {
-        if (methodName == "createCube")
-        {
-            return ExecuteCreateCube(args);
-        }
-        else if (methodName == "moveProp")
-        {
-            return ExecuteMoveProp(args);
-        }
-        else if (methodName == "getPlayerPosition")
-        {
-            return ExecuteGetPlayerPosition(args);
-        }
-        else if (methodName == "executeCommand")
-        {
-            return ExecuteJavaScriptCommand(args);
-        }
-        else if (methodName == "executeFile")
-        {
-            return ExecuteJavaScriptFile(args);
-        }
-        else if (methodName == "isAttractMode")
-        {
-            return ExecuteIsAttractMode(args);
-        }
-        else if (methodName == "getGameState")
+        if (!ScriptCallProfiler::IsEnabled())
         {
-            return ExecuteGetGameState(args);
+            return binding->m_invoker(*m_game, args, binding->m_name, binding->m_minArgCount, nullptr);
         }
 
-        return ScriptMethodResult::Error("未知的方法: " + methodName);
+        uint64_t const     startNs      = ScriptCallProfiler::GetTimeNs();
+        uint64_t           conversionNs = 0;
+        ScriptMethodResult result       = binding->m_invoker(*m_game, args, binding->m_name, binding->m_minArgCount, &conversionNs);
+
+        ScriptCallProfiler::Record(binding->m_profileSlot, ScriptCallProfiler::GetTimeNs() - startNs, conversionNs);
+        return result;
     }
     catch (const std::exception& e)
     {
@@ -131,7 +159,7 @@ std::any GameScriptInterface::GetProperty(const std::string& propertyName) const
     }
     else if (propertyName == "gameState")
     {
-        return m_game->IsAttractMode() ? "attract" : "game";
+        return m_game->GetGameStateName();
     }
 
     return std::any{};
@@ -146,318 +174,3 @@ bool GameScriptInterface::SetProperty(const std::string& propertyName, const std
     UNUSED(value);
     return false;
 }
-
-//----------------------------------------------------------------------------------------------------
-ScriptMethodResult GameScriptInterface::ExecuteCreateCube(const std::vector<std::any>& args)
-{
-    auto result = ValidateArgCount(args, 3, "createCube");
-    if (!result.success)
-        return result;
-
-    try
-    {
-        Vec3 position = ExtractVec3(args, 0);
-        m_game->CreateCube(position);
-        return ScriptMethodResult::Success(std::string("立方體創建成功，位置: (" +
-            std::to_string(position.x) + ", " +
-            std::to_string(position.y) + ", " +
-            std::to_string(position.z) + ")"));
-    }
-    catch (const std::exception& e)
-    {
-        return ScriptMethodResult::Error("創建立方體失敗: " + std::string(e.what()));
-    }
-}
-
-//----------------------------------------------------------------------------------------------------
-ScriptMethodResult GameScriptInterface::ExecuteMoveProp(const std::vector<std::any>& args)
-{
-    auto result = ValidateArgCount(args, 4, "moveProp");
-    if (!result.success)
-        return result;
-
-    try
-    {
-        int propIndex = ExtractInt(args[0]);
-        Vec3 newPosition = ExtractVec3(args, 1);
-        m_game->MoveProp(propIndex, newPosition);
-        return ScriptMethodResult::Success(std::string("道具 " + std::to_string(propIndex) +
-            " 移動成功，新位置: (" +
-            std::to_string(newPosition.x) + ", " +
-            std::to_string(newPosition.y) + ", " +
-            std::to_string(newPosition.z) + ")"));
-    }
-    catch (const std::exception& e)
-    {
-        return ScriptMethodResult::Error("移動道具失敗: " + std::string(e.what()));
-    }
-}
-
-//----------------------------------------------------------------------------------------------------
-ScriptMethodResult GameScriptInterface::ExecuteGetPlayerPosition(const std::vector<std::any>& args)
-{
-    auto result = ValidateArgCount(args, 0, "getPlayerPosition");
-    if (!result.success)
-        return result;
-
-    try
-    {
-        Player* player = m_game->GetPlayer();
-        if (!player)
-        {
-            return ScriptMethodResult::Error("玩家物件不存在");
-        }
-
-        // 這裡假設 Player 有 GetPosition 方法
-        // 您可能需要根據實際的 Player 類別 API 調整
-        // Vec3 position = player->GetPosition();
-
-        // 暫時回傳一個假的位置，您可以根據實際 API 修改
-        Vec3 position(0.0f, 0.0f, 0.0f);
-
-        // 回傳一個可以被 JavaScript 使用的物件
-        std::string positionStr = "{ x: " + std::to_string(position.x) +
-                                ", y: " + std::to_string(position.y) +
-                                ", z: " + std::to_string(position.z) + " }";
-
-        return ScriptMethodResult::Success(positionStr);
-    }
-    catch (const std::exception& e)
-    {
-        return ScriptMethodResult::Error("取得玩家位置失敗: " + std::string(e.what()));
-    }
-}
-
-//----------------------------------------------------------------------------------------------------
-ScriptMethodResult GameScriptInterface::ExecuteJavaScriptCommand(const std::vector<std::any>& args)
-{
-    auto result = ValidateArgCount(args, 1, "executeCommand");
-    if (!result.success)
-        return result;
-
-    try
-    {
-        std::string command = ExtractString(args[0]);
-        m_game->ExecuteJavaScriptCommand(command);
-        return ScriptMethodResult::Success(std::string("指令執行: " + command));
-    }
-    catch (const std::exception& e)
-    {
-        return ScriptMethodResult::Error("執行 JavaScript 指令失敗: " + std::string(e.what()));
-    }
-}
-
-//----------------------------------------------------------------------------------------------------
-ScriptMethodResult GameScriptInterface::ExecuteJavaScriptFile(const std::vector<std::any>& args)
-{
-    auto result = ValidateArgCount(args, 1, "executeFile");
-    if (!result.success)
-        return result;
-
-    try
-    {
-        std::string filename = ExtractString(args[0]);
-        m_game->ExecuteJavaScriptFile(filename);
-        return ScriptMethodResult::Success(std::string("檔案執行: " + filename));
-    }
-    catch (const std::exception& e)
-    {
-        return ScriptMethodResult::Error("執行 JavaScript 檔案失敗: " + std::string(e.what()));
-    }
-}
-
-//----------------------------------------------------------------------------------------------------
-ScriptMethodResult GameScriptInterface::ExecuteIsAttractMode(const std::vector<std::any>& args)
-{
-    auto result = ValidateArgCount(args, 0, "isAttractMode");
-    if (!result.success)
-        return result;
-
-    try
-    {
-        bool isAttract = m_game->IsAttractMode();
-        return ScriptMethodResult::Success(isAttract);
-    }
-    catch (const std::exception& e)
-    {
-        return ScriptMethodResult::Error("檢查吸引模式失敗: " + std::string(e.what()));
-    }
-}
-
-//----------------------------------------------------------------------------------------------------
-ScriptMethodResult GameScriptInterface::ExecuteGetGameState(const std::vector<std::any>& args)
-{
-    auto result = ValidateArgCount(args, 0, "getGameState");
-    if (!result.success)
-        return result;
-
-    try
-    {
-        std::string state = m_game->IsAttractMode() ? "attract" : "game";
-        return ScriptMethodResult::Success(state);
-    }
-    catch (const std::exception& e)
-    {
-        return ScriptMethodResult::Error("取得遊戲狀態失敗: " + std::string(e.what()));
-    }
-}
-
-//----------------------------------------------------------------------------------------------------
-// 輔助方法實作
-//----------------------------------------------------------------------------------------------------
-
-template<typename T>
-T GameScriptInterface::ExtractArg(const std::any& arg, const std::string& expectedType) const
-{
-    try
-    {
-        return std::any_cast<T>(arg);
-    }
-    catch (const std::bad_any_cast& e)
-    {
-        std::string typeInfo = expectedType.empty() ? typeid(T).name() : expectedType;
-        throw std::invalid_argument("參數類型錯誤，期望: " + typeInfo);
-    }
-}
-
-//----------------------------------------------------------------------------------------------------
-Vec3 GameScriptInterface::ExtractVec3(const std::vector<std::any>& args, size_t startIndex) const
-{
-    if (startIndex + 2 >= args.size())
-    {
-        throw std::invalid_argument("Vec3 需要 3 個參數 (x, y, z)");
-    }
-
-    float x = ExtractFloat(args[startIndex]);
-    float y = ExtractFloat(args[startIndex + 1]);
-    float z = ExtractFloat(args[startIndex + 2]);
-
-    return Vec3(x, y, z);
-}
-
-//----------------------------------------------------------------------------------------------------
-float GameScriptInterface::ExtractFloat(const std::any& arg) const
-{
-    // 嘗試多種數值類型的轉換
-    try
-    {
-        return std::any_cast<float>(arg);
-    }
-    catch (const std::bad_any_cast&)
-    {
-        try
-        {
-            return static_cast<float>(std::any_cast<double>(arg));
-        }
-        catch (const std::bad_any_cast&)
-        {
-            try
-            {
-                return static_cast<float>(std::any_cast<int>(arg));
-            }
-            catch (const std::bad_any_cast&)
-            {
-                throw std::invalid_argument("無法轉換為 float 類型");
-            }
-        }
-    }
-}
-
-//----------------------------------------------------------------------------------------------------
-int GameScriptInterface::ExtractInt(const std::any& arg) const
-{
-    try
-    {
-        return std::any_cast<int>(arg);
-    }
-    catch (const std::bad_any_cast&)
-    {
-        try
-        {
-            return static_cast<int>(std::any_cast<float>(arg));
-        }
-        catch (const std::bad_any_cast&)
-        {
-            try
-            {
-                return static_cast<int>(std::any_cast<double>(arg));
-            }
-            catch (const std::bad_any_cast&)
-            {
-                throw std::invalid_argument("無法轉換為 int 類型");
-            }
-        }
-    }
-}
-
-//----------------------------------------------------------------------------------------------------
-std::string GameScriptInterface::ExtractString(const std::any& arg) const
-{
-    try
-    {
-        return std::any_cast<std::string>(arg);
-    }
-    catch (const std::bad_any_cast&)
-    {
-        try
-        {
-            const char* cstr = std::any_cast<const char*>(arg);
-            return std::string(cstr);
-        }
-        catch (const std::bad_any_cast&)
-        {
-            throw std::invalid_argument("無法轉換為 string 類型");
-        }
-    }
-}
-
-//----------------------------------------------------------------------------------------------------
-bool GameScriptInterface::ExtractBool(const std::any& arg) const
-{
-    try
-    {
-        return std::any_cast<bool>(arg);
-    }
-    catch (const std::bad_any_cast&)
-    {
-        try
-        {
-            // 嘗試從數值轉換
-            int val = std::any_cast<int>(arg);
-            return val != 0;
-        }
-        catch (const std::bad_any_cast&)
-        {
-            throw std::invalid_argument("無法轉換為 bool 類型");
-        }
-    }
-}
-
-//----------------------------------------------------------------------------------------------------
-ScriptMethodResult GameScriptInterface::ValidateArgCount(const std::vector<std::any>& args,
-                                                        size_t expectedCount,
-                                                        const std::string& methodName) const
-{
-    if (args.size() != expectedCount)
-    {
-        std::ostringstream oss;
-        oss << methodName << " 需要 " << expectedCount << " 個參數，但收到 " << args.size() << " 個";
-        return ScriptMethodResult::Error(oss.str());
-    }
-    return ScriptMethodResult::Success();
-}
-
-//----------------------------------------------------------------------------------------------------
-ScriptMethodResult GameScriptInterface::ValidateArgCountRange(const std::vector<std::any>& args,
-                                                            size_t minCount,
-                                                            size_t maxCount,
-                                                            const std::string& methodName) const
-{
-    if (args.size() < minCount || args.size() > maxCount)
-    {
-        std::ostringstream oss;
-        oss << methodName << " 需要 " << minCount << "-" << maxCount << " 個參數，但收到 " << args.size() << " 個";
-        return ScriptMethodResult::Error(oss.str());
-    }
-    return ScriptMethodResult::Success();
-}
\ No newline at end of file
@@ -0,0 +1,136 @@
+//----------------------------------------------------------------------------------------------------
+// HandleTable.hpp
+// 世代式控制代碼表 - O(1) 配置、釋放與驗證查詢，釋放的 slot 以 free list 重複使用
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+#include "Game/Framework/EntityHandle.hpp"
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+class HandleTable
+{
+public:
+    sEntityHandle Allocate(T const& value);
+    bool          Release(sEntityHandle handle);
+
+    T*       Resolve(sEntityHandle handle);
+    T const* Resolve(sEntityHandle handle) const;
+    bool     IsValid(sEntityHandle const handle) const { return Resolve(handle) != nullptr; }
+
+    // 以 slot 索引直接存取（不比對世代），供以 slot 索引定址的共享資料使用；slot 未使用時回傳 nullptr
+    T* ResolveSlot(uint32_t slotIndex);
+
+    void   Reserve(size_t const count) { m_slots.reserve(count); }
+    size_t GetLiveCount() const { return m_liveCount; }
+
+private:
+    static uint32_t constexpr INVALID_SLOT = UINT32_MAX;
+
+    struct sSlot
+    {
+        T        m_value      = {};
+        uint32_t m_generation = 1;
+        uint32_t m_nextFree   = INVALID_SLOT;
+        bool     m_isLive     = false;
+    };
+
+    std::vector<sSlot> m_slots;
+    uint32_t           m_freeHead  = INVALID_SLOT;
+    size_t             m_liveCount = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// slot 用盡時回傳無效的控制代碼
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+sEntityHandle HandleTable<T>::Allocate(T const& value)
+{
+    uint32_t slotIndex = m_freeHead;
+
+    if (slotIndex != INVALID_SLOT)
+    {
+        m_freeHead = m_slots[slotIndex].m_nextFree;
+    }
+    else
+    {
+        if (m_slots.size() >= sEntityHandle::MAX_SLOT_COUNT)
+        {
+            return {};
+        }
+
+        slotIndex = static_cast<uint32_t>(m_slots.size());
+        m_slots.emplace_back();
+    }
+
+    sSlot& slot     = m_slots[slotIndex];
+    slot.m_value    = value;
+    slot.m_nextFree = INVALID_SLOT;
+    slot.m_isLive   = true;
+    ++m_liveCount;
+
+    return sEntityHandle::Make(slotIndex, slot.m_generation);
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+bool HandleTable<T>::Release(sEntityHandle const handle)
+{
+    if (!IsValid(handle))
+    {
+        return false;
+    }
+
+    uint32_t const slotIndex = handle.GetIndex();
+    sSlot&         slot      = m_slots[slotIndex];
+
+    slot.m_value      = {};
+    slot.m_isLive     = false;
+    slot.m_generation = (slot.m_generation & sEntityHandle::GENERATION_MASK) == sEntityHandle::GENERATION_MASK ? 1 : slot.m_generation + 1;
+    slot.m_nextFree   = m_freeHead;
+    m_freeHead        = slotIndex;
+    --m_liveCount;
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+T* HandleTable<T>::Resolve(sEntityHandle const handle)
+{
+    return const_cast<T*>(static_cast<HandleTable const*>(this)->Resolve(handle));
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+T const* HandleTable<T>::Resolve(sEntityHandle const handle) const
+{
+    uint32_t const slotIndex = handle.GetIndex();
+
+    if (!handle.IsValid() || slotIndex >= m_slots.size())
+    {
+        return nullptr;
+    }
+
+    sSlot const& slot = m_slots[slotIndex];
+
+    if (!slot.m_isLive || slot.m_generation != handle.GetGeneration())
+    {
+        return nullptr;
+    }
+
+    return &slot.m_value;
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+T* HandleTable<T>::ResolveSlot(uint32_t const slotIndex)
+{
+    if (slotIndex >= m_slots.size() || !m_slots[slotIndex].m_isLive)
+    {
+        return nullptr;
+    }
+
+    return &m_slots[slotIndex].m_value;
+}
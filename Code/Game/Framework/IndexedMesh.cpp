@@ -0,0 +1,326 @@
+//----------------------------------------------------------------------------------------------------
+// IndexedMesh.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/IndexedMesh.hpp"
+
+#include "Engine/Core/VertexUtils.hpp"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    // Forsyth 建議的參數
+    int constexpr   FORSYTH_CACHE_SIZE          = 32;
+    float constexpr FORSYTH_CACHE_DECAY_POWER   = 1.5f;
+    float constexpr FORSYTH_LAST_TRIANGLE_SCORE = 0.75f;
+    float constexpr FORSYTH_VALENCE_BOOST_SCALE = 2.f;
+    float constexpr FORSYTH_VALENCE_BOOST_POWER = 0.5f;
+
+    //------------------------------------------------------------------------------------------------
+    // cachePosition < 0 表示不在快取中；剛輸出的三角形的 3 個頂點得到固定分數，不鼓勵立刻重複使用同一個三角形的邊
+    //------------------------------------------------------------------------------------------------
+    float GetForsythVertexScore(int const cachePosition, uint32_t const remainingTriangles)
+    {
+        if (remainingTriangles == 0)
+        {
+            return -1.f;
+        }
+
+        float score = 0.f;
+
+        if (cachePosition >= 0)
+        {
+            if (cachePosition < 3)
+            {
+                score = FORSYTH_LAST_TRIANGLE_SCORE;
+            }
+            else
+            {
+                float const scale = 1.f / static_cast<float>(FORSYTH_CACHE_SIZE - 3);
+                score             = std::pow(1.f - static_cast<float>(cachePosition - 3) * scale, FORSYTH_CACHE_DECAY_POWER);
+            }
+        }
+
+        return score + FORSYTH_VALENCE_BOOST_SCALE * std::pow(static_cast<float>(remainingTriangles), -FORSYTH_VALENCE_BOOST_POWER);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    std::string_view GetVertexBytes(Vertex_PCU const& vertex)
+    {
+        return std::string_view(reinterpret_cast<char const*>(&vertex), sizeof(Vertex_PCU));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void AppendWeldedTriangles(sIndexedMesh& mesh, std::vector<Vertex_PCU> const& triangles)
+{
+    std::unordered_map<std::string_view, unsigned> indexByVertex;
+    indexByVertex.reserve(triangles.size());
+
+    mesh.m_indexes.reserve(mesh.m_indexes.size() + triangles.size());
+
+    for (Vertex_PCU const& vertex : triangles)
+    {
+        auto const [iterator, isNew] = indexByVertex.try_emplace(GetVertexBytes(vertex), static_cast<unsigned>(mesh.m_vertexes.size()));
+
+        if (isNew)
+        {
+            mesh.m_vertexes.push_back(vertex);
+        }
+
+        mesh.m_indexes.push_back(iterator->second);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void ExpandIndexedMesh(sIndexedMesh const& mesh, std::vector<Vertex_PCU>& outTriangles)
+{
+    outTriangles.clear();
+    outTriangles.reserve(mesh.m_indexes.size());
+
+    for (unsigned const index : mesh.m_indexes)
+    {
+        outTriangles.push_back(mesh.m_vertexes[index]);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void AddIndexedVertsForQuad3D(sIndexedMesh& mesh, Vec3 const& bottomLeft, Vec3 const& bottomRight, Vec3 const& topLeft, Vec3 const& topRight, Rgba8 const& color, AABB2 const& UVs)
+{
+    std::vector<Vertex_PCU> triangles;
+    AddVertsForQuad3D(triangles, bottomLeft, bottomRight, topLeft, topRight, color, UVs);
+    AppendWeldedTriangles(mesh, triangles);
+}
+
+//----------------------------------------------------------------------------------------------------
+void AddIndexedVertsForAABB3D(sIndexedMesh& mesh, AABB3 const& bounds, Rgba8 const& color, AABB2 const& UVs)
+{
+    std::vector<Vertex_PCU> triangles;
+    AddVertsForAABB3D(triangles, bounds, color, UVs);
+    AppendWeldedTriangles(mesh, triangles);
+}
+
+//----------------------------------------------------------------------------------------------------
+void AddIndexedVertsForSphere3D(sIndexedMesh& mesh, Vec3 const& center, float const radius, Rgba8 const& color, AABB2 const& UVs, int const numSlices, int const numStacks)
+{
+    std::vector<Vertex_PCU> triangles;
+    AddVertsForSphere3D(triangles, center, radius, color, UVs, numSlices, numStacks);
+    AppendWeldedTriangles(mesh, triangles);
+}
+
+//----------------------------------------------------------------------------------------------------
+// 每個頂點的相鄰三角形以 CSR 陣列存放，輸出三角形時從頂點的清單中移除（與清單最後一個交換）。
+// 只有剛進出快取的頂點需要重新計分，因此每輸出一個三角形只更新快取內頂點的相鄰三角形；
+// 快取中沒有候選三角形時（例如一個不相連的部分結束）依輸入順序取下一個尚未輸出的三角形，整體維持線性時間。
+//----------------------------------------------------------------------------------------------------
+void OptimizeVertexCache(std::vector<unsigned>& indexes, size_t const vertexCount)
+{
+    size_t const triangleCount = indexes.size() / 3;
+
+    if (triangleCount == 0 || vertexCount == 0)
+    {
+        return;
+    }
+
+    std::vector<uint32_t> remainingTriangles(vertexCount, 0);
+
+    for (unsigned const index : indexes)
+    {
+        ++remainingTriangles[index];
+    }
+
+    std::vector<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+
+    for (size_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex)
+    {
+        adjacencyOffsets[vertexIndex + 1] = adjacencyOffsets[vertexIndex] + remainingTriangles[vertexIndex];
+    }
+
+    std::vector<uint32_t> adjacency(indexes.size());
+    std::vector<uint32_t> adjacencyFill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+
+    for (size_t triangleIndex = 0; triangleIndex < triangleCount; ++triangleIndex)
+    {
+        for (int corner = 0; corner < 3; ++corner)
+        {
+            adjacency[adjacencyFill[indexes[triangleIndex * 3 + corner]]++] = static_cast<uint32_t>(triangleIndex);
+        }
+    }
+
+    std::vector<int>   cachePositions(vertexCount, -1);
+    std::vector<float> vertexScores(vertexCount);
+
+    for (size_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex)
+    {
+        vertexScores[vertexIndex] = GetForsythVertexScore(-1, remainingTriangles[vertexIndex]);
+    }
+
+    std::vector<bool> isTriangleEmitted(triangleCount, false);
+
+    std::vector<unsigned> reordered;
+    reordered.reserve(indexes.size());
+
+    std::vector<unsigned> cache;
+    std::vector<unsigned> nextCache;
+    cache.reserve(FORSYTH_CACHE_SIZE + 3);
+    nextCache.reserve(FORSYTH_CACHE_SIZE + 3);
+
+    int64_t bestTriangle          = -1;
+    size_t  nextUnemittedTriangle = 0;
+
+    for (size_t emittedCount = 0; emittedCount < triangleCount; ++emittedCount)
+    {
+        if (bestTriangle < 0)
+        {
+            while (isTriangleEmitted[nextUnemittedTriangle])
+            {
+                ++nextUnemittedTriangle;
+            }
+
+            bestTriangle = static_cast<int64_t>(nextUnemittedTriangle);
+        }
+
+        size_t const    triangleIndex = static_cast<size_t>(bestTriangle);
+        unsigned const* corners       = &indexes[triangleIndex * 3];
+
+        isTriangleEmitted[triangleIndex] = true;
+        reordered.insert(reordered.end(), corners, corners + 3);
+
+        // 從三個頂點的相鄰清單移除這個三角形
+        for (int corner = 0; corner < 3; ++corner)
+        {
+            unsigned const vertexIndex = corners[corner];
+            uint32_t const begin       = adjacencyOffsets[vertexIndex];
+            uint32_t const end         = begin + remainingTriangles[vertexIndex];
+
+            for (uint32_t slot = begin; slot < end; ++slot)
+            {
+                if (adjacency[slot] == triangleIndex)
+                {
+                    std::swap(adjacency[slot], adjacency[end - 1]);
+                    break;
+                }
+            }
+
+            --remainingTriangles[vertexIndex];
+        }
+
+        // 三角形的頂點移到快取最前面，其餘頂點依序往後，超出快取大小的頂點移出
+        nextCache.assign(corners, corners + 3);
+
+        for (unsigned const vertexIndex : cache)
+        {
+            if (vertexIndex != corners[0] && vertexIndex != corners[1] && vertexIndex != corners[2])
+            {
+                nextCache.push_back(vertexIndex);
+            }
+        }
+
+        for (size_t position = 0; position < nextCache.size(); ++position)
+        {
+            unsigned const vertexIndex = nextCache[position];
+
+            cachePositions[vertexIndex] = position < FORSYTH_CACHE_SIZE ? static_cast<int>(position) : -1;
+            vertexScores[vertexIndex]   = GetForsythVertexScore(cachePositions[vertexIndex], remainingTriangles[vertexIndex]);
+        }
+
+        // 只有快取內（含剛移出的）頂點的分數改變，重新計算它們剩餘三角形的分數並找出最高分
+        float bestScore = -FLT_MAX;
+        bestTriangle    = -1;
+
+        for (unsigned const vertexIndex : nextCache)
+        {
+            uint32_t const begin = adjacencyOffsets[vertexIndex];
+            uint32_t const end   = begin + remainingTriangles[vertexIndex];
+
+            for (uint32_t slot = begin; slot < end; ++slot)
+            {
+                uint32_t const adjacentTriangle = adjacency[slot];
+                unsigned const* adjacentCorners = &indexes[static_cast<size_t>(adjacentTriangle) * 3];
+                float const     score           = vertexScores[adjacentCorners[0]] + vertexScores[adjacentCorners[1]] + vertexScores[adjacentCorners[2]];
+
+                if (score > bestScore)
+                {
+                    bestScore    = score;
+                    bestTriangle = adjacentTriangle;
+                }
+            }
+        }
+
+        if (nextCache.size() > FORSYTH_CACHE_SIZE)
+        {
+            nextCache.resize(FORSYTH_CACHE_SIZE);
+        }
+
+        std::swap(cache, nextCache);
+    }
+
+    indexes.swap(reordered);
+}
+
+//----------------------------------------------------------------------------------------------------
+void OptimizeVertexFetch(sIndexedMesh& mesh)
+{
+    std::vector<unsigned>   remap(mesh.m_vertexes.size(), UINT32_MAX);
+    std::vector<Vertex_PCU> vertexes;
+    vertexes.reserve(mesh.m_vertexes.size());
+
+    for (unsigned& index : mesh.m_indexes)
+    {
+        if (remap[index] == UINT32_MAX)
+        {
+            remap[index] = static_cast<unsigned>(vertexes.size());
+            vertexes.push_back(mesh.m_vertexes[index]);
+        }
+
+        index = remap[index];
+    }
+
+    mesh.m_vertexes.swap(vertexes);
+}
+
+//----------------------------------------------------------------------------------------------------
+float GetAverageCacheMissRatio(std::vector<unsigned> const& indexes, size_t const vertexCount, uint32_t const cacheSize)
+{
+    size_t const triangleCount = indexes.size() / 3;
+
+    if (triangleCount == 0)
+    {
+        return 0.f;
+    }
+
+    // 每個頂點記錄進入快取時的累計未命中次數；差距小於快取大小表示仍在 FIFO 中
+    std::vector<uint64_t> insertedAt(vertexCount, UINT64_MAX);
+    uint64_t              missCount = 0;
+
+    for (unsigned const index : indexes)
+    {
+        if (insertedAt[index] == UINT64_MAX || missCount - insertedAt[index] >= cacheSize)
+        {
+            insertedAt[index] = missCount;
+            ++missCount;
+        }
+    }
+
+    return static_cast<float>(missCount) / static_cast<float>(triangleCount);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool PackIndexesTo16Bit(std::vector<unsigned> const& indexes, std::vector<uint16_t>& outIndexes)
+{
+    if (std::any_of(indexes.begin(), indexes.end(), [](unsigned const index) { return index > UINT16_MAX; }))
+    {
+        return false;
+    }
+
+    outIndexes.assign(indexes.begin(), indexes.end());
+
+    return true;
+}
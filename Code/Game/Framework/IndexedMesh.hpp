@@ -0,0 +1,51 @@
+//----------------------------------------------------------------------------------------------------
+// IndexedMesh.hpp
+// 索引網格 - 把三角形列表合併重複頂點成為頂點＋索引，並重排索引以提高 GPU 頂點快取命中率
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+#include "Engine/Core/Vertex_PCU.hpp"
+#include <cstdint>
+#include <vector>
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+struct AABB2;
+struct AABB3;
+struct Rgba8;
+struct Vec3;
+
+//----------------------------------------------------------------------------------------------------
+// 索引以 32 位元產生與最佳化；MeshRegistry 登錄時對頂點數不超過 UINT16_MAX 的 mesh 以 PackIndexesTo16Bit 改存 16 位元
+//----------------------------------------------------------------------------------------------------
+struct sIndexedMesh
+{
+    std::vector<Vertex_PCU> m_vertexes;
+    std::vector<unsigned>   m_indexes;
+};
+
+//----------------------------------------------------------------------------------------------------
+// 只合併每個位元組都相同的頂點（同一位置但 UV 或顏色不同的頂點保留），三角形順序與每個三角形的頂點順序不變，
+// 因此 ExpandIndexedMesh 展開的結果與輸入逐位元組相同。合併只在這次加入的三角形之間進行。
+//----------------------------------------------------------------------------------------------------
+void AppendWeldedTriangles(sIndexedMesh& mesh, std::vector<Vertex_PCU> const& triangles);
+void ExpandIndexedMesh(sIndexedMesh const& mesh, std::vector<Vertex_PCU>& outTriangles);
+
+// Engine 三角形列表產生函數的索引版本：以相同的函數產生後再合併，展開後與非索引版本逐位元組相同
+void AddIndexedVertsForQuad3D(sIndexedMesh& mesh, Vec3 const& bottomLeft, Vec3 const& bottomRight, Vec3 const& topLeft, Vec3 const& topRight, Rgba8 const& color, AABB2 const& UVs);
+void AddIndexedVertsForAABB3D(sIndexedMesh& mesh, AABB3 const& bounds, Rgba8 const& color, AABB2 const& UVs);
+void AddIndexedVertsForSphere3D(sIndexedMesh& mesh, Vec3 const& center, float radius, Rgba8 const& color, AABB2 const& UVs, int numSlices, int numStacks);
+
+//----------------------------------------------------------------------------------------------------
+// Tom Forsyth 的線性時間頂點快取最佳化：以模擬的 LRU 快取為每個頂點計分（最近使用、剩餘三角形少的頂點分數高），
+// 每次輸出分數最高的三角形。只重排三角形，三角形內的頂點順序（繞向）不變。
+//----------------------------------------------------------------------------------------------------
+void OptimizeVertexCache(std::vector<unsigned>& indexes, size_t vertexCount);
+
+// 依索引中第一次出現的順序重新編號頂點，讓頂點讀取大致連續；應在 OptimizeVertexCache 之後呼叫
+void OptimizeVertexFetch(sIndexedMesh& mesh);
+
+// 以 FIFO 快取模擬每個三角形平均的頂點快取未命中次數（ACMR），非索引的三角形列表為 3
+float GetAverageCacheMissRatio(std::vector<unsigned> const& indexes, size_t vertexCount, uint32_t cacheSize = 16);
+
+// 任何索引超過 16 位元時回傳 false，outIndexes 不變
+bool PackIndexesTo16Bit(std::vector<unsigned> const& indexes, std::vector<uint16_t>& outIndexes);
@@ -0,0 +1,129 @@
+//----------------------------------------------------------------------------------------------------
+// InstanceBatcher.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/InstanceBatcher.hpp"
+
+#include "Game/Framework/MeshRegistry.hpp"
+#include <algorithm>
+#include <functional>
+
+//----------------------------------------------------------------------------------------------------
+InstanceBatcher::InstanceBatcher(sInstanceBatcherConfig const& config)
+    : m_config(config)
+{
+    m_config.m_maxInstancesPerDraw = std::max(m_config.m_maxInstancesPerDraw, 1u);
+}
+
+//----------------------------------------------------------------------------------------------------
+void InstanceBatcher::Reset()
+{
+    m_pendingKeys.clear();
+    m_pendingInstances.clear();
+    m_instances.clear();
+    m_batches.clear();
+}
+
+//----------------------------------------------------------------------------------------------------
+void InstanceBatcher::Reserve(size_t const instanceCount)
+{
+    m_pendingKeys.reserve(instanceCount);
+    m_pendingInstances.reserve(instanceCount);
+    m_instances.reserve(instanceCount);
+}
+
+//----------------------------------------------------------------------------------------------------
+void InstanceBatcher::AddInstance(uint32_t const meshId, Shader* shader, Texture const* texture, Mat44 const& modelToWorld, Rgba8 const& tint)
+{
+    m_pendingKeys.push_back({shader, texture, meshId, static_cast<uint32_t>(m_pendingInstances.size())});
+    m_pendingInstances.push_back({modelToWorld, tint});
+}
+
+//----------------------------------------------------------------------------------------------------
+void InstanceBatcher::ResizePending(size_t const instanceCount)
+{
+    m_pendingKeys.resize(instanceCount);
+    m_pendingInstances.resize(instanceCount);
+}
+
+//----------------------------------------------------------------------------------------------------
+void InstanceBatcher::SetInstance(size_t const index, uint32_t const meshId, Shader* shader, Texture const* texture, Mat44 const& modelToWorld, Rgba8 const& tint)
+{
+    m_pendingKeys[index]      = {shader, texture, meshId, static_cast<uint32_t>(index)};
+    m_pendingInstances[index] = {modelToWorld, tint};
+}
+
+//----------------------------------------------------------------------------------------------------
+void InstanceBatcher::Build()
+{
+    m_instances.clear();
+    m_batches.clear();
+
+    std::stable_sort(m_pendingKeys.begin(), m_pendingKeys.end(), [](sInstanceKey const& a, sInstanceKey const& b) {
+        if (a.m_shader != b.m_shader)
+        {
+            return std::less<Shader*>()(a.m_shader, b.m_shader);
+        }
+
+        if (a.m_texture != b.m_texture)
+        {
+            return std::less<Texture const*>()(a.m_texture, b.m_texture);
+        }
+
+        return a.m_meshId < b.m_meshId;
+    });
+
+    for (sInstanceKey const& key : m_pendingKeys)
+    {
+        bool const sameBatch = !m_batches.empty() &&
+                               m_batches.back().m_shader == key.m_shader &&
+                               m_batches.back().m_texture == key.m_texture &&
+                               m_batches.back().m_meshId == key.m_meshId &&
+                               m_batches.back().m_instanceCount < m_config.m_maxInstancesPerDraw;
+
+        if (!sameBatch)
+        {
+            m_batches.push_back({key.m_shader, key.m_texture, key.m_meshId, static_cast<uint32_t>(m_instances.size()), 0});
+        }
+
+        m_instances.push_back(m_pendingInstances[key.m_instanceIndex]);
+        ++m_batches.back().m_instanceCount;
+    }
+
+    m_pendingKeys.clear();
+    m_pendingInstances.clear();
+}
+
+//----------------------------------------------------------------------------------------------------
+// 登錄表中找不到的 mesh 略過，不計入繪製次數
+//----------------------------------------------------------------------------------------------------
+int InstanceBatcher::Submit(IRenderBackend& backend, MeshRegistry const& meshRegistry) const
+{
+    int            drawCount    = 0;
+    bool           hasMaterial  = false;
+    Shader*        boundShader  = nullptr;
+    Texture const* boundTexture = nullptr;
+
+    for (sInstanceBatch const& batch : m_batches)
+    {
+        sMeshEntry const* mesh = meshRegistry.GetMesh(batch.m_meshId);
+        if (!mesh)
+        {
+            continue;
+        }
+
+        if (!hasMaterial || batch.m_shader != boundShader || batch.m_texture != boundTexture)
+        {
+            backend.BindMaterial(batch.m_shader, batch.m_texture);
+            hasMaterial  = true;
+            boundShader  = batch.m_shader;
+            boundTexture = batch.m_texture;
+        }
+
+        backend.DrawInstances(batch.m_meshId, *mesh, std::span<sInstanceData const>(m_instances).subspan(batch.m_firstInstance, batch.m_instanceCount));
+        ++drawCount;
+    }
+
+    return drawCount;
+}
@@ -0,0 +1,70 @@
+//----------------------------------------------------------------------------------------------------
+// InstanceBatcher.hpp
+// 實例批次器 - 收集同一 mesh、同一材質的道具，建立連續的實例緩衝區，每個批次交給後端一次（材質只綁定一次）
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+#include "Game/Framework/RenderBackend.hpp"
+#include <cstdint>
+#include <span>
+#include <vector>
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class MeshRegistry;
+
+//----------------------------------------------------------------------------------------------------
+struct sInstanceBatcherConfig
+{
+    uint32_t m_maxInstancesPerDraw = 1024;   // 單一批次的實例上限
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sInstanceBatch
+{
+    Shader*        m_shader        = nullptr;
+    Texture const* m_texture       = nullptr;
+    uint32_t       m_meshId        = 0;
+    uint32_t       m_firstInstance = 0;
+    uint32_t       m_instanceCount = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// 每幀流程：Reset -> AddInstance（任意順序）-> Build -> Submit
+//  - Build 依 (shader, 貼圖, mesh) 穩定排序，同一批次內保持加入順序
+//  - 建立後 GetInstances 為連續的實例緩衝區，GetBatches 描述每個批次在其中的範圍
+//  - Submit 只在材質改變時呼叫 BindMaterial，回傳送出的繪製次數
+//----------------------------------------------------------------------------------------------------
+class InstanceBatcher
+{
+public:
+    explicit InstanceBatcher(sInstanceBatcherConfig const& config = {});
+
+    void Reset();
+    void Reserve(size_t instanceCount);
+    void AddInstance(uint32_t meshId, Shader* shader, Texture const* texture, Mat44 const& modelToWorld, Rgba8 const& tint);
+
+    // 平行填入：先 ResizePending 決定數量，之後各執行緒以不重疊的索引呼叫 SetInstance，全部完成後才 Build
+    void ResizePending(size_t instanceCount);
+    void SetInstance(size_t index, uint32_t meshId, Shader* shader, Texture const* texture, Mat44 const& modelToWorld, Rgba8 const& tint);
+    void Build();
+    int  Submit(IRenderBackend& backend, MeshRegistry const& meshRegistry) const;
+
+    std::span<sInstanceData const>  GetInstances() const { return m_instances; }
+    std::span<sInstanceBatch const> GetBatches() const { return m_batches; }
+    size_t                          GetPendingCount() const { return m_pendingKeys.size(); }
+
+private:
+    struct sInstanceKey
+    {
+        Shader*        m_shader        = nullptr;
+        Texture const* m_texture       = nullptr;
+        uint32_t       m_meshId        = 0;
+        uint32_t       m_instanceIndex = 0;   // m_pendingInstances 的索引
+    };
+
+    sInstanceBatcherConfig      m_config;
+    std::vector<sInstanceKey>   m_pendingKeys;
+    std::vector<sInstanceData>  m_pendingInstances;
+    std::vector<sInstanceData>  m_instances;
+    std::vector<sInstanceBatch> m_batches;
+};
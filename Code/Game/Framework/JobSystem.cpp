@@ -0,0 +1,226 @@
+//----------------------------------------------------------------------------------------------------
+// JobSystem.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/JobSystem.hpp"
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Game/Framework/FrameProfiler.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    // 目前執行緒在「哪一個 JobSystem」的第幾個佇列；不屬於任何 JobSystem 的執行緒（例如資源載入執行緒）
+    // 提交的工作放進佇列 0
+    thread_local JobSystem const* t_jobSystem  = nullptr;
+    thread_local uint32_t         t_queueIndex = 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+JobSystem::JobSystem(sJobSystemConfig const& config)
+{
+    uint32_t const workerThreadCount = ComputeWorkerThreadCount(config);
+
+    m_queues.reserve(workerThreadCount + 1);
+
+    for (uint32_t queueIndex = 0; queueIndex <= workerThreadCount; ++queueIndex)
+    {
+        m_queues.push_back(std::make_unique<sWorkQueue>());
+    }
+
+    t_jobSystem  = this;
+    t_queueIndex = 0;
+
+    m_workers.reserve(workerThreadCount);
+
+    for (uint32_t workerIndex = 0; workerIndex < workerThreadCount; ++workerIndex)
+    {
+        m_workers.emplace_back(&JobSystem::WorkerMain, this, workerIndex + 1);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard<std::mutex> const lock(m_wakeMutex);
+        m_isStopping.store(true);
+    }
+
+    m_wakeCondition.notify_all();
+
+    for (std::thread& worker : m_workers)
+    {
+        worker.join();
+    }
+
+    if (t_jobSystem == this)
+    {
+        t_jobSystem = nullptr;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void JobSystem::Submit(sJob const& job)
+{
+    if (m_workers.empty())
+    {
+        RunJob(job);
+        return;
+    }
+
+    // 計數先於入列遞增，取出後才遞減，計數不會小於佇列中實際的工作數；
+    // 在 m_wakeMutex 內遞增，等待中的工作執行緒不會錯過這次喚醒
+    {
+        std::lock_guard<std::mutex> const lock(m_wakeMutex);
+        m_pendingJobCount.fetch_add(1, std::memory_order_release);
+    }
+
+    sWorkQueue& queue = *m_queues[GetCurrentQueueIndex()];
+
+    {
+        std::lock_guard<std::mutex> const lock(queue.m_mutex);
+        queue.m_jobs.push_back(job);
+    }
+
+    m_wakeCondition.notify_one();
+}
+
+//----------------------------------------------------------------------------------------------------
+void JobSystem::Wait(sJobCounter const& counter)
+{
+    uint32_t const queueIndex = GetCurrentQueueIndex();
+
+    while (counter.m_remaining.load(std::memory_order_acquire) > 0)
+    {
+        if (!TryRunOneJob(queueIndex))
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// 保留一個硬體執行緒給主執行緒，並扣除其他子系統常駐的執行緒；至少 1 個（單核心時為 0，全部在主執行緒執行）
+//----------------------------------------------------------------------------------------------------
+STATIC uint32_t JobSystem::ComputeWorkerThreadCount(sJobSystemConfig const& config)
+{
+    if (config.m_workerThreadCount > 0)
+    {
+        return config.m_workerThreadCount;
+    }
+
+    uint32_t const hardwareThreadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+    if (hardwareThreadCount <= 1)
+    {
+        return 0;
+    }
+
+    uint32_t const usedThreadCount = 1 + config.m_reservedThreadCount;
+
+    return hardwareThreadCount > usedThreadCount ? hardwareThreadCount - usedThreadCount : 1;
+}
+
+//----------------------------------------------------------------------------------------------------
+void JobSystem::WorkerMain(uint32_t const queueIndex)
+{
+    t_jobSystem  = this;
+    t_queueIndex = queueIndex;
+
+    std::string const threadName = Stringf("JobWorker %u", queueIndex);
+    FrameProfiler::SetThreadName(threadName.c_str());
+
+    while (true)
+    {
+        if (TryRunOneJob(queueIndex))
+        {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_wakeMutex);
+        m_wakeCondition.wait(lock, [this] {
+            return m_isStopping.load() || m_pendingJobCount.load(std::memory_order_acquire) > 0;
+        });
+
+        if (m_isStopping.load())
+        {
+            return;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+bool JobSystem::TryRunOneJob(uint32_t const queueIndex)
+{
+    sJob job;
+
+    if (!TryPopOwn(queueIndex, job) && !TrySteal(queueIndex, job))
+    {
+        return false;
+    }
+
+    m_pendingJobCount.fetch_sub(1, std::memory_order_acq_rel);
+    RunJob(job);
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool JobSystem::TryPopOwn(uint32_t const queueIndex, sJob& outJob)
+{
+    sWorkQueue&                       queue = *m_queues[queueIndex];
+    std::lock_guard<std::mutex> const lock(queue.m_mutex);
+
+    if (queue.m_jobs.empty())
+    {
+        return false;
+    }
+
+    outJob = queue.m_jobs.back();
+    queue.m_jobs.pop_back();
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// 從下一個佇列開始輪流嘗試，避免所有偷取者都先搶同一個佇列
+//----------------------------------------------------------------------------------------------------
+bool JobSystem::TrySteal(uint32_t const thiefIndex, sJob& outJob)
+{
+    uint32_t const queueCount = static_cast<uint32_t>(m_queues.size());
+
+    for (uint32_t offset = 1; offset < queueCount; ++offset)
+    {
+        sWorkQueue&                       queue = *m_queues[(thiefIndex + offset) % queueCount];
+        std::lock_guard<std::mutex> const lock(queue.m_mutex);
+
+        if (!queue.m_jobs.empty())
+        {
+            outJob = queue.m_jobs.front();
+            queue.m_jobs.pop_front();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------------------------------
+void JobSystem::RunJob(sJob const& job)
+{
+    PROFILE_SCOPE("JobSystem::RunJob");
+
+    job.m_function(job.m_context, job.m_begin, job.m_end);
+
+    if (job.m_counter)
+    {
+        job.m_counter->m_remaining.fetch_sub(1, std::memory_order_acq_rel);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+uint32_t JobSystem::GetCurrentQueueIndex() const
+{
+    return t_jobSystem == this ? t_queueIndex : 0;
+}
@@ -0,0 +1,131 @@
+//----------------------------------------------------------------------------------------------------
+// JobSystem.hpp
+// 工作竊取（work-stealing）工作系統 - 每個執行緒一個雙端佇列，閒置的執行緒從其他佇列偷取工作；提供 ParallelFor
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+struct sJobSystemConfig
+{
+    uint32_t m_workerThreadCount   = 0;   // 0 表示依硬體執行緒數自動決定
+    uint32_t m_reservedThreadCount = 0;   // 其他子系統常駐的執行緒（例如資源載入），自動決定時扣除
+};
+
+//----------------------------------------------------------------------------------------------------
+// 等待一組工作完成；每個工作完成時遞減
+//----------------------------------------------------------------------------------------------------
+struct sJobCounter
+{
+    std::atomic<uint32_t> m_remaining = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// 處理 [m_begin, m_end) 範圍；m_function 與 m_context 由提交者保證在 Wait 返回前有效
+//----------------------------------------------------------------------------------------------------
+struct sJob
+{
+    void (*m_function)(void* context, uint32_t begin, uint32_t end) = nullptr;
+    void*        m_context = nullptr;
+    uint32_t     m_begin   = 0;
+    uint32_t     m_end     = 0;
+    sJobCounter* m_counter = nullptr;
+};
+
+//----------------------------------------------------------------------------------------------------
+// 佇列 0 屬於建立 JobSystem 的執行緒（主執行緒），1..N 屬於工作執行緒。
+// 擁有者從自己佇列的尾端取出（LIFO，快取較熱），偷取者從頭端取出（FIFO，通常是較大的剩餘工作）。
+// 每個佇列有自己的鎖，只有同一個佇列的擁有者與偷取者會互相競爭。
+//
+// Wait 不會閒置：等待中的執行緒持續執行自己或偷來的工作，因此工作中可以再呼叫 ParallelFor。
+// 工作執行緒數為 0 時（單核心或設定如此），所有工作直接在呼叫端執行。
+//----------------------------------------------------------------------------------------------------
+class JobSystem
+{
+public:
+    explicit JobSystem(sJobSystemConfig const& config = {});
+    ~JobSystem();
+
+    JobSystem(JobSystem const&)            = delete;
+    JobSystem& operator=(JobSystem const&) = delete;
+
+    void Submit(sJob const& job);
+    void Wait(sJobCounter const& counter);
+
+    // function(begin, end) 以 grainSize 為最小單位分段平行執行，返回時全部完成
+    template <typename Function>
+    void ParallelFor(uint32_t count, uint32_t grainSize, Function const& function);
+
+    uint32_t GetWorkerThreadCount() const { return static_cast<uint32_t>(m_workers.size()); }
+
+    static uint32_t ComputeWorkerThreadCount(sJobSystemConfig const& config);
+
+private:
+    struct sWorkQueue
+    {
+        std::mutex       m_mutex;
+        std::deque<sJob> m_jobs;
+    };
+
+    void WorkerMain(uint32_t queueIndex);
+    bool TryRunOneJob(uint32_t queueIndex);
+    bool TryPopOwn(uint32_t queueIndex, sJob& outJob);
+    bool TrySteal(uint32_t thiefIndex, sJob& outJob);
+    void RunJob(sJob const& job);
+
+    uint32_t GetCurrentQueueIndex() const;
+
+    std::vector<std::unique_ptr<sWorkQueue>> m_queues;
+    std::vector<std::thread>                 m_workers;
+    std::atomic<uint32_t>                    m_pendingJobCount = 0;
+    std::atomic<bool>                        m_isStopping      = false;
+    std::mutex                               m_wakeMutex;
+    std::condition_variable                  m_wakeCondition;
+};
+
+//----------------------------------------------------------------------------------------------------
+// 分段數量最多為執行緒數的 4 倍，讓偷取能平衡不均勻的分段耗時
+//----------------------------------------------------------------------------------------------------
+template <typename Function>
+void JobSystem::ParallelFor(uint32_t const count, uint32_t const grainSize, Function const& function)
+{
+    uint32_t const minChunkSize = grainSize > 0 ? grainSize : 1;
+
+    if (count == 0)
+    {
+        return;
+    }
+
+    if (m_workers.empty() || count <= minChunkSize)
+    {
+        function(0u, count);
+        return;
+    }
+
+    uint32_t const maxChunkCount = (GetWorkerThreadCount() + 1) * 4;
+    uint32_t const chunkCount    = std::min((count + minChunkSize - 1) / minChunkSize, maxChunkCount);
+    uint32_t const chunkSize     = (count + chunkCount - 1) / chunkCount;
+
+    sJobCounter counter;
+    counter.m_remaining.store((count + chunkSize - 1) / chunkSize, std::memory_order_relaxed);
+
+    auto const trampoline = [](void* context, uint32_t const begin, uint32_t const end) {
+        (*static_cast<Function const*>(context))(begin, end);
+    };
+
+    for (uint32_t begin = 0; begin < count; begin += chunkSize)
+    {
+        Submit({trampoline, const_cast<Function*>(&function), begin, std::min(begin + chunkSize, count), &counter});
+    }
+
+    Wait(counter);
+}
@@ -0,0 +1,129 @@
+//----------------------------------------------------------------------------------------------------
+// MeshLod.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/MeshLod.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+
+//----------------------------------------------------------------------------------------------------
+uint8_t sMeshLodChain::SelectLevel(float const screenSize, uint8_t const currentLevel) const
+{
+    uint8_t level = std::min(currentLevel, static_cast<uint8_t>(m_levelCount - 1));
+
+    while (level + 1 < m_levelCount && screenSize < m_switchScreenSizes[level + 1] * (1.f - m_hysteresis))
+    {
+        ++level;
+    }
+
+    while (level > 0 && screenSize > m_switchScreenSizes[level] * (1.f + m_hysteresis))
+    {
+        --level;
+    }
+
+    return level;
+}
+
+//----------------------------------------------------------------------------------------------------
+float GetProjectedScreenSize(float const boundingRadius, float const distance, float const tanHalfVerticalFov)
+{
+    return boundingRadius / (std::max(distance, boundingRadius) * tanHalfVerticalFov);
+}
+
+//----------------------------------------------------------------------------------------------------
+// 第一輪決定每個頂點所在的格子並累加位置，第二輪輸出三個頂點落在不同格子、且尚未輸出過的三角形
+//----------------------------------------------------------------------------------------------------
+void GenerateClusteredLod(std::vector<Vertex_PCU> const& triangles, int cellsPerAxis, std::vector<Vertex_PCU>& outTriangles)
+{
+    outTriangles.clear();
+
+    // 格子索引要小於 2^21，三個索引才能放進一個 64 位元的鍵
+    cellsPerAxis = std::min(cellsPerAxis, 128);
+
+    if (triangles.size() < 3 || cellsPerAxis < 1)
+    {
+        return;
+    }
+
+    Vec3 mins = triangles.front().m_position;
+    Vec3 maxs = mins;
+
+    for (Vertex_PCU const& vertex : triangles)
+    {
+        mins = Vec3(std::min(mins.x, vertex.m_position.x), std::min(mins.y, vertex.m_position.y), std::min(mins.z, vertex.m_position.z));
+        maxs = Vec3(std::max(maxs.x, vertex.m_position.x), std::max(maxs.y, vertex.m_position.y), std::max(maxs.z, vertex.m_position.z));
+    }
+
+    float const cellCount = static_cast<float>(cellsPerAxis);
+    Vec3 const  extents   = maxs - mins;
+
+    auto const getCellCoordinate = [cellsPerAxis, cellCount](float const value, float const minValue, float const extent) {
+        int const cell = extent > 0.f ? static_cast<int>((value - minValue) / extent * cellCount) : 0;
+        return std::clamp(cell, 0, cellsPerAxis - 1);
+    };
+
+    struct sCluster
+    {
+        Vertex_PCU m_vertex;
+        Vec3       m_positionSum;
+        int        m_count = 0;
+    };
+
+    std::unordered_map<uint32_t, sCluster> clusters;
+    std::vector<uint32_t>                  vertexCells(triangles.size());
+
+    for (size_t vertexIndex = 0; vertexIndex < triangles.size(); ++vertexIndex)
+    {
+        Vertex_PCU const& vertex = triangles[vertexIndex];
+        uint32_t const    cellX  = static_cast<uint32_t>(getCellCoordinate(vertex.m_position.x, mins.x, extents.x));
+        uint32_t const    cellY  = static_cast<uint32_t>(getCellCoordinate(vertex.m_position.y, mins.y, extents.y));
+        uint32_t const    cellZ  = static_cast<uint32_t>(getCellCoordinate(vertex.m_position.z, mins.z, extents.z));
+        uint32_t const    cell   = (cellZ * static_cast<uint32_t>(cellsPerAxis) + cellY) * static_cast<uint32_t>(cellsPerAxis) + cellX;
+
+        sCluster& cluster = clusters[cell];
+
+        if (cluster.m_count == 0)
+        {
+            cluster.m_vertex = vertex;
+        }
+
+        cluster.m_positionSum += vertex.m_position;
+        ++cluster.m_count;
+        vertexCells[vertexIndex] = cell;
+    }
+
+    for (std::pair<uint32_t const, sCluster>& entry : clusters)
+    {
+        entry.second.m_vertex.m_position = entry.second.m_positionSum / static_cast<float>(entry.second.m_count);
+    }
+
+    // 三角形以最小的格子開頭旋轉（保留繞向）作為鍵，合併後重複的三角形只輸出一次
+    std::unordered_set<uint64_t> emittedTriangles;
+
+    for (size_t firstVertex = 0; firstVertex + 2 < triangles.size(); firstVertex += 3)
+    {
+        uint32_t cells[3] = {vertexCells[firstVertex], vertexCells[firstVertex + 1], vertexCells[firstVertex + 2]};
+
+        if (cells[0] == cells[1] || cells[1] == cells[2] || cells[2] == cells[0])
+        {
+            continue;
+        }
+
+        int const rotation = (cells[0] < cells[1] && cells[0] < cells[2]) ? 0 : (cells[1] < cells[2] ? 1 : 2);
+        std::rotate(cells, cells + rotation, cells + 3);
+
+        uint64_t const key = (static_cast<uint64_t>(cells[0]) << 42) | (static_cast<uint64_t>(cells[1]) << 21) | cells[2];
+
+        if (!emittedTriangles.insert(key).second)
+        {
+            continue;
+        }
+
+        outTriangles.push_back(clusters[cells[0]].m_vertex);
+        outTriangles.push_back(clusters[cells[1]].m_vertex);
+        outTriangles.push_back(clusters[cells[2]].m_vertex);
+    }
+}
@@ -0,0 +1,39 @@
+//----------------------------------------------------------------------------------------------------
+// MeshLod.hpp
+// 網格細節層級（LOD）- 依投影到螢幕的大小選擇層級（含遲滯），並以頂點聚類產生低細節的網格
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+#include "Engine/Core/Vertex_PCU.hpp"
+#include <cstdint>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+uint8_t constexpr MAX_MESH_LOD_COUNT = 4;
+
+//----------------------------------------------------------------------------------------------------
+// 層級 0 是原本的 mesh；層級 i（i >= 1）在螢幕大小小於 m_switchScreenSizes[i] 時使用，門檻逐級遞減。
+// 遲滯：往較粗的層級切換要小於門檻 × (1 - m_hysteresis)，往較細的層級切換要大於門檻 × (1 + m_hysteresis)，
+// 在門檻附近來回移動的道具不會每幀切換 mesh。
+//----------------------------------------------------------------------------------------------------
+struct sMeshLodChain
+{
+    uint32_t m_meshIds[MAX_MESH_LOD_COUNT]           = {};
+    float    m_switchScreenSizes[MAX_MESH_LOD_COUNT] = {};   // [0] 不使用
+    uint8_t  m_levelCount                            = 1;
+    float    m_hysteresis                            = 0.15f;
+
+    uint8_t SelectLevel(float screenSize, uint8_t currentLevel) const;
+};
+
+//----------------------------------------------------------------------------------------------------
+// 包圍球直徑佔畫面高度的比例（1 = 剛好填滿垂直視野）；距離小於半徑時視為貼著包圍球
+//----------------------------------------------------------------------------------------------------
+float GetProjectedScreenSize(float boundingRadius, float distance, float tanHalfVerticalFov);
+
+//----------------------------------------------------------------------------------------------------
+// 頂點聚類簡化：把包圍盒切成 cellsPerAxis^3 個格子，同一格的頂點合併到格內頂點的平均位置
+// （顏色與 UV 取第一個落入的頂點），任兩個頂點落在同一格的三角形已經退化，直接捨棄。
+// 只需要非索引的三角形列表、不需要拓撲資訊，程序產生或載入的模型都能使用；cellsPerAxis 越小細節越低（最多 128）。
+//----------------------------------------------------------------------------------------------------
+void GenerateClusteredLod(std::vector<Vertex_PCU> const& triangles, int cellsPerAxis, std::vector<Vertex_PCU>& outTriangles);
@@ -0,0 +1,181 @@
+//----------------------------------------------------------------------------------------------------
+// MeshRegistry.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/MeshRegistry.hpp"
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Renderer/IndexBuffer.hpp"
+#include "Engine/Renderer/Renderer.hpp"
+#include "Engine/Renderer/VertexBuffer.hpp"
+#include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/IndexedMesh.hpp"
+#include <algorithm>
+
+//----------------------------------------------------------------------------------------------------
+MeshRegistry::~MeshRegistry()
+{
+    Clear();
+}
+
+//----------------------------------------------------------------------------------------------------
+uint32_t MeshRegistry::RegisterMesh(std::string const& name, std::vector<Vertex_PCU> const& vertexes, std::vector<unsigned> const& indexes)
+{
+    uint32_t const existingId = FindMeshId(name);
+
+    if (existingId != INVALID_MESH_ID)
+    {
+        return existingId;
+    }
+
+    sMeshEntry entry;
+    entry.m_name        = name;
+    entry.m_vertexes    = vertexes;
+    entry.m_vertexCount = static_cast<uint32_t>(vertexes.size());
+    entry.m_indexCount  = static_cast<uint32_t>(indexes.size());
+
+    if (vertexes.size() > UINT16_MAX || !PackIndexesTo16Bit(indexes, entry.m_shortIndexes))
+    {
+        entry.m_indexes = indexes;
+    }
+
+    if (!vertexes.empty())
+    {
+        entry.m_localBounds = AABB3(vertexes.front().m_position, vertexes.front().m_position);
+
+        for (Vertex_PCU const& vertex : vertexes)
+        {
+            entry.m_localBounds.m_mins.x = std::min(entry.m_localBounds.m_mins.x, vertex.m_position.x);
+            entry.m_localBounds.m_mins.y = std::min(entry.m_localBounds.m_mins.y, vertex.m_position.y);
+            entry.m_localBounds.m_mins.z = std::min(entry.m_localBounds.m_mins.z, vertex.m_position.z);
+            entry.m_localBounds.m_maxs.x = std::max(entry.m_localBounds.m_maxs.x, vertex.m_position.x);
+            entry.m_localBounds.m_maxs.y = std::max(entry.m_localBounds.m_maxs.y, vertex.m_position.y);
+            entry.m_localBounds.m_maxs.z = std::max(entry.m_localBounds.m_maxs.z, vertex.m_position.z);
+            entry.m_boundingRadius       = std::max(entry.m_boundingRadius, vertex.m_position.GetLength());
+        }
+    }
+
+    if (g_theRenderer && !vertexes.empty())
+    {
+        unsigned int const vertexBytes = static_cast<unsigned int>(vertexes.size() * sizeof(Vertex_PCU));
+
+        entry.m_vertexBuffer = g_theRenderer->CreateVertexBuffer(vertexBytes, sizeof(Vertex_PCU));
+        g_theRenderer->CopyCPUToGPU(vertexes.data(), vertexBytes, entry.m_vertexBuffer);
+
+        if (!indexes.empty())
+        {
+            unsigned int const indexBytes = static_cast<unsigned int>(indexes.size() * sizeof(unsigned));
+
+            entry.m_indexBuffer = g_theRenderer->CreateIndexBuffer(indexBytes, sizeof(unsigned));
+            g_theRenderer->CopyCPUToGPU(indexes.data(), indexBytes, entry.m_indexBuffer);
+        }
+    }
+
+    entry.m_lodChain.m_meshIds[0] = static_cast<uint32_t>(m_meshes.size());
+
+    m_meshes.push_back(std::move(entry));
+
+    return static_cast<uint32_t>(m_meshes.size() - 1);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool MeshRegistry::AddLodLevel(uint32_t const meshId, uint32_t const lodMeshId, float const switchScreenSize)
+{
+    if (meshId >= m_meshes.size() || lodMeshId >= m_meshes.size())
+    {
+        return false;
+    }
+
+    sMeshLodChain& chain = m_meshes[meshId].m_lodChain;
+
+    if (chain.m_levelCount >= MAX_MESH_LOD_COUNT)
+    {
+        return false;
+    }
+
+    if (chain.m_levelCount > 1 && switchScreenSize >= chain.m_switchScreenSizes[chain.m_levelCount - 1])
+    {
+        return false;
+    }
+
+    chain.m_meshIds[chain.m_levelCount]           = lodMeshId;
+    chain.m_switchScreenSizes[chain.m_levelCount] = switchScreenSize;
+    ++chain.m_levelCount;
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+uint32_t MeshRegistry::GetLodMeshId(uint32_t const meshId, uint8_t const lodLevel) const
+{
+    sMeshEntry const* mesh = GetMesh(meshId);
+
+    if (!mesh || lodLevel >= mesh->m_lodChain.m_levelCount)
+    {
+        return meshId;
+    }
+
+    return mesh->m_lodChain.m_meshIds[lodLevel];
+}
+
+//----------------------------------------------------------------------------------------------------
+uint32_t MeshRegistry::FindMeshId(std::string const& name) const
+{
+    for (size_t meshIndex = 0; meshIndex < m_meshes.size(); ++meshIndex)
+    {
+        if (m_meshes[meshIndex].m_name == name)
+        {
+            return static_cast<uint32_t>(meshIndex);
+        }
+    }
+
+    return INVALID_MESH_ID;
+}
+
+//----------------------------------------------------------------------------------------------------
+sMeshEntry const* MeshRegistry::GetMesh(uint32_t const meshId) const
+{
+    return meshId < m_meshes.size() ? &m_meshes[meshId] : nullptr;
+}
+
+//----------------------------------------------------------------------------------------------------
+// 只發出繪製呼叫，繪製狀態與模型常數由呼叫端設定
+//----------------------------------------------------------------------------------------------------
+void MeshRegistry::Draw(uint32_t const meshId) const
+{
+    if (sMeshEntry const* mesh = GetMesh(meshId))
+    {
+        Draw(*mesh);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC void MeshRegistry::Draw(sMeshEntry const& mesh)
+{
+    if (!mesh.m_vertexBuffer)
+    {
+        return;
+    }
+
+    if (mesh.m_indexBuffer)
+    {
+        g_theRenderer->DrawIndexedVertexBuffer(mesh.m_vertexBuffer, mesh.m_indexBuffer, mesh.m_indexCount);
+    }
+    else
+    {
+        g_theRenderer->DrawVertexBuffer(mesh.m_vertexBuffer, mesh.m_vertexCount);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void MeshRegistry::Clear()
+{
+    for (sMeshEntry& mesh : m_meshes)
+    {
+        GAME_SAFE_RELEASE(mesh.m_vertexBuffer);
+        GAME_SAFE_RELEASE(mesh.m_indexBuffer);
+    }
+
+    m_meshes.clear();
+}
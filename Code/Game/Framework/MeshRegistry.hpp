@@ -0,0 +1,86 @@
+//----------------------------------------------------------------------------------------------------
+// MeshRegistry.hpp
+// 共用 mesh 登錄表 - 每種形狀只產生一次並上傳到常駐的頂點／索引緩衝區，道具以 mesh ID 引用
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+#include "Engine/Core/Vertex_PCU.hpp"
+#include "Engine/Math/AABB3.hpp"
+#include "Game/Framework/MeshLod.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class IndexBuffer;
+class VertexBuffer;
+
+//----------------------------------------------------------------------------------------------------
+// 索引的 CPU 端副本只存一種寬度：頂點數不超過 UINT16_MAX 時存 16 位元（m_shortIndexes），否則存 32 位元（m_indexes）。
+// 以 ForEachIndex 走訪，不需要知道實際的寬度
+//----------------------------------------------------------------------------------------------------
+struct sMeshEntry
+{
+    std::string                       m_name;
+    std::vector<Vertex_PCU>           m_vertexes;                // CPU 端副本
+    uint32_t                          m_vertexCount    = 0;
+    std::vector<unsigned>             m_indexes;
+    std::vector<uint16_t>             m_shortIndexes;
+    uint32_t                          m_indexCount     = 0;      // 0 表示非索引的三角形列表
+    AABB3                             m_localBounds;
+    float                             m_boundingRadius = 0.f;    // 頂點到原點的最大距離；任何旋轉下都包住 mesh，剔除用
+    sMeshLodChain                     m_lodChain;                // 層級 0 為自己；只有一個層級時不做 LOD 選擇
+    VertexBuffer*                     m_vertexBuffer = nullptr;
+    IndexBuffer*                      m_indexBuffer  = nullptr;
+
+    bool IsIndexed() const { return m_indexCount > 0; }
+
+    template <typename Function>
+    void ForEachIndex(Function const& function) const
+    {
+        for (uint16_t const index : m_shortIndexes)
+        {
+            function(static_cast<unsigned>(index));
+        }
+
+        for (unsigned const index : m_indexes)
+        {
+            function(index);
+        }
+    }
+};
+
+//----------------------------------------------------------------------------------------------------
+// 同名的 mesh 只登錄一次，重複登錄回傳既有的 ID。
+// GPU 緩衝區在登錄時建立一次，之後每次繪製只綁定、不再上傳頂點。
+// GPU 的索引緩衝區一律是 32 位元：Engine 的 Renderer 以 R32_UINT 綁定索引緩衝區。
+// 沒有 Renderer 時（例如工具程式）只保留 CPU 端資料，Draw 不做任何事。
+//----------------------------------------------------------------------------------------------------
+class MeshRegistry
+{
+public:
+    static uint32_t constexpr INVALID_MESH_ID = UINT32_MAX;
+
+    MeshRegistry() = default;
+    ~MeshRegistry();
+
+    MeshRegistry(MeshRegistry const&)            = delete;
+    MeshRegistry& operator=(MeshRegistry const&) = delete;
+
+    uint32_t RegisterMesh(std::string const& name, std::vector<Vertex_PCU> const& vertexes, std::vector<unsigned> const& indexes = {});
+    uint32_t FindMeshId(std::string const& name) const;
+
+    // 把已登錄的 lodMeshId 接在 meshId 的 LOD 鏈最後；門檻必須小於前一個層級，鏈滿或門檻不遞減時回傳 false
+    bool     AddLodLevel(uint32_t meshId, uint32_t lodMeshId, float switchScreenSize);
+    uint32_t GetLodMeshId(uint32_t meshId, uint8_t lodLevel) const;
+
+    sMeshEntry const* GetMesh(uint32_t meshId) const;
+    size_t            GetMeshCount() const { return m_meshes.size(); }
+
+    void        Draw(uint32_t meshId) const;
+    static void Draw(sMeshEntry const& mesh);
+    void        Clear();
+
+private:
+    std::vector<sMeshEntry> m_meshes;
+};
@@ -0,0 +1,412 @@
+//----------------------------------------------------------------------------------------------------
+// OcclusionBuffer.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/OcclusionBuffer.hpp"
+
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/Vec2.hpp"
+#include "Game/Framework/FrameProfiler.hpp"
+#include "Game/Framework/JobSystem.hpp"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <emmintrin.h>
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    Vec3 GetBoxCorner(AABB3 const& bounds, int const cornerIndex)
+    {
+        return Vec3((cornerIndex & 1) ? bounds.m_maxs.x : bounds.m_mins.x,
+                    (cornerIndex & 2) ? bounds.m_maxs.y : bounds.m_mins.y,
+                    (cornerIndex & 4) ? bounds.m_maxs.z : bounds.m_mins.z);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    float GetCross2D(Vec2 const& origin, Vec2 const& a, Vec2 const& b)
+    {
+        return (a.x - origin.x) * (b.y - origin.y) - (a.y - origin.y) * (b.x - origin.x);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Andrew 單調鏈；回傳逆時針的凸包頂點數，共線的點不保留
+    //------------------------------------------------------------------------------------------------
+    int BuildConvexHull(Vec2 (&points)[8], Vec2 (&outHull)[16])
+    {
+        std::sort(std::begin(points), std::end(points), [](Vec2 const& a, Vec2 const& b) {
+            return a.x < b.x || (a.x == b.x && a.y < b.y);
+        });
+
+        int hullCount = 0;
+
+        for (Vec2 const& point : points)
+        {
+            while (hullCount >= 2 && GetCross2D(outHull[hullCount - 2], outHull[hullCount - 1], point) <= 0.f)
+            {
+                --hullCount;
+            }
+
+            outHull[hullCount++] = point;
+        }
+
+        int const lowerCount = hullCount + 1;
+
+        for (int pointIndex = 6; pointIndex >= 0; --pointIndex)
+        {
+            while (hullCount >= lowerCount && GetCross2D(outHull[hullCount - 2], outHull[hullCount - 1], points[pointIndex]) <= 0.f)
+            {
+                --hullCount;
+            }
+
+            outHull[hullCount++] = points[pointIndex];
+        }
+
+        return hullCount - 1;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+OcclusionBuffer::OcclusionBuffer(sOcclusionBufferConfig const& config)
+    : m_config(config)
+{
+    m_tileCountX = m_config.m_width / m_config.m_tileWidth;
+    m_tileCountY = m_config.m_height / m_config.m_tileHeight;
+
+    m_inverseDepths.resize(static_cast<size_t>(m_config.m_width) * m_config.m_height, 0.f);
+    m_tileMinInverseDepths.resize(static_cast<size_t>(m_tileCountX) * m_tileCountY, 0.f);
+    m_tileOccluders.resize(static_cast<size_t>(m_tileCountX) * m_tileCountY);
+}
+
+//----------------------------------------------------------------------------------------------------
+void OcclusionBuffer::BeginFrame(sPerspectiveView const& view)
+{
+    view.m_orientation.GetAsVectors_IFwd_JLeft_KUp(m_forward, m_left, m_up);
+
+    float const tanVertical   = view.GetTanHalfVerticalFov();
+    float const tanHorizontal = tanVertical * view.m_aspect;
+
+    m_viewPosition = view.m_position;
+    m_nearZ        = view.m_nearZ;
+    m_screenScaleX = 0.5f * static_cast<float>(m_config.m_width) / tanHorizontal;
+    m_screenScaleY = 0.5f * static_cast<float>(m_config.m_height) / tanVertical;
+
+    std::fill(m_inverseDepths.begin(), m_inverseDepths.end(), 0.f);
+    std::fill(m_tileMinInverseDepths.begin(), m_tileMinInverseDepths.end(), 0.f);
+    m_occluders.clear();
+
+    for (std::vector<uint32_t>& tileOccluders : m_tileOccluders)
+    {
+        tileOccluders.clear();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// 凸包以最遠的角的深度當作整個輪廓的深度，比盒子實際的表面遠，因此寫入的深度不會比真正的遮擋物近；
+// 任何角在近平面前方時整個盒子捨棄
+//----------------------------------------------------------------------------------------------------
+void OcclusionBuffer::AddOccluderBox(Mat44 const& modelToWorld, AABB3 const& localBounds)
+{
+    Vec2  screenCorners[8];
+    float farthestInverseDepth = FLT_MAX;
+
+    for (int cornerIndex = 0; cornerIndex < 8; ++cornerIndex)
+    {
+        float inverseDepth;
+
+        if (!ProjectToScreen(modelToWorld.TransformPosition3D(GetBoxCorner(localBounds, cornerIndex)), screenCorners[cornerIndex].x, screenCorners[cornerIndex].y, inverseDepth))
+        {
+            return;
+        }
+
+        farthestInverseDepth = std::min(farthestInverseDepth, inverseDepth);
+    }
+
+    Vec2      hull[16];
+    int const hullCount = BuildConvexHull(screenCorners, hull);
+
+    if (hullCount < 3 || hullCount > MAX_SILHOUETTE_VERTEXES)
+    {
+        return;
+    }
+
+    sScreenOccluder occluder;
+    occluder.m_vertexCount  = static_cast<uint32_t>(hullCount);
+    occluder.m_inverseDepth = farthestInverseDepth;
+
+    float minX = FLT_MAX;
+    float minY = FLT_MAX;
+    float maxX = -FLT_MAX;
+    float maxY = -FLT_MAX;
+
+    for (int vertexIndex = 0; vertexIndex < hullCount; ++vertexIndex)
+    {
+        occluder.m_x[vertexIndex] = hull[vertexIndex].x;
+        occluder.m_y[vertexIndex] = hull[vertexIndex].y;
+
+        minX = std::min(minX, hull[vertexIndex].x);
+        minY = std::min(minY, hull[vertexIndex].y);
+        maxX = std::max(maxX, hull[vertexIndex].x);
+        maxY = std::max(maxY, hull[vertexIndex].y);
+    }
+
+    if (maxX < 0.f || maxY < 0.f || minX >= static_cast<float>(m_config.m_width) || minY >= static_cast<float>(m_config.m_height))
+    {
+        return;
+    }
+
+    uint32_t const occluderIndex = static_cast<uint32_t>(m_occluders.size());
+    m_occluders.push_back(occluder);
+
+    uint32_t const tileX0 = static_cast<uint32_t>(std::max(minX, 0.f)) / m_config.m_tileWidth;
+    uint32_t const tileY0 = static_cast<uint32_t>(std::max(minY, 0.f)) / m_config.m_tileHeight;
+    uint32_t const tileX1 = std::min(static_cast<uint32_t>(maxX) / m_config.m_tileWidth, m_tileCountX - 1);
+    uint32_t const tileY1 = std::min(static_cast<uint32_t>(maxY) / m_config.m_tileHeight, m_tileCountY - 1);
+
+    for (uint32_t tileY = tileY0; tileY <= tileY1; ++tileY)
+    {
+        for (uint32_t tileX = tileX0; tileX <= tileX1; ++tileX)
+        {
+            m_tileOccluders[tileY * m_tileCountX + tileX].push_back(occluderIndex);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void OcclusionBuffer::Rasterize(JobSystem* jobSystem)
+{
+    PROFILE_SCOPE("OcclusionBuffer::Rasterize");
+
+    uint32_t const tileCount = m_tileCountX * m_tileCountY;
+
+    if (!jobSystem)
+    {
+        for (uint32_t tileIndex = 0; tileIndex < tileCount; ++tileIndex)
+        {
+            RasterizeTile(tileIndex);
+        }
+
+        return;
+    }
+
+    jobSystem->ParallelFor(tileCount, 1, [this](uint32_t const begin, uint32_t const end) {
+        for (uint32_t tileIndex = begin; tileIndex < end; ++tileIndex)
+        {
+            RasterizeTile(tileIndex);
+        }
+    });
+}
+
+//----------------------------------------------------------------------------------------------------
+// 先以每個 tile 最遠的深度快速判定，只有不確定的 tile 才逐像素比較（一次 4 個像素）
+//----------------------------------------------------------------------------------------------------
+bool OcclusionBuffer::IsAabbVisible(AABB3 const& worldBounds) const
+{
+    float minX                = static_cast<float>(m_config.m_width);
+    float minY                = static_cast<float>(m_config.m_height);
+    float maxX                = 0.f;
+    float maxY                = 0.f;
+    float nearestInverseDepth = 0.f;
+
+    for (int cornerIndex = 0; cornerIndex < 8; ++cornerIndex)
+    {
+        float x;
+        float y;
+        float inverseDepth;
+
+        if (!ProjectToScreen(GetBoxCorner(worldBounds, cornerIndex), x, y, inverseDepth))
+        {
+            return true;
+        }
+
+        minX                = std::min(minX, x);
+        minY                = std::min(minY, y);
+        maxX                = std::max(maxX, x);
+        maxY                = std::max(maxY, y);
+        nearestInverseDepth = std::max(nearestInverseDepth, inverseDepth);
+    }
+
+    int const pixelX0 = std::max(static_cast<int>(std::floor(minX)), 0);
+    int const pixelY0 = std::max(static_cast<int>(std::floor(minY)), 0);
+    int const pixelX1 = std::min(static_cast<int>(std::ceil(maxX)), static_cast<int>(m_config.m_width));
+    int const pixelY1 = std::min(static_cast<int>(std::ceil(maxY)), static_cast<int>(m_config.m_height));
+
+    if (pixelX0 >= pixelX1 || pixelY0 >= pixelY1)
+    {
+        return true;
+    }
+
+    int const tileWidth  = static_cast<int>(m_config.m_tileWidth);
+    int const tileHeight = static_cast<int>(m_config.m_tileHeight);
+
+    __m128 const  nearest   = _mm_set1_ps(nearestInverseDepth);
+    __m128i const laneIndex = _mm_setr_epi32(0, 1, 2, 3);
+
+    for (int tileY = pixelY0 / tileHeight; tileY <= (pixelY1 - 1) / tileHeight; ++tileY)
+    {
+        for (int tileX = pixelX0 / tileWidth; tileX <= (pixelX1 - 1) / tileWidth; ++tileX)
+        {
+            if (m_tileMinInverseDepths[tileY * m_tileCountX + tileX] > nearestInverseDepth)
+            {
+                continue;
+            }
+
+            int const x0 = std::max(pixelX0, tileX * tileWidth);
+            int const x1 = std::min(pixelX1, (tileX + 1) * tileWidth);
+            int const y0 = std::max(pixelY0, tileY * tileHeight);
+            int const y1 = std::min(pixelY1, (tileY + 1) * tileHeight);
+
+            // 行的起點對齊到 4，超出 [x0, x1) 的通道以遮罩排除
+            __m128i const firstX = _mm_set1_epi32(x0);
+            __m128i const endX   = _mm_set1_epi32(x1);
+
+            for (int y = y0; y < y1; ++y)
+            {
+                float const* row = m_inverseDepths.data() + static_cast<size_t>(y) * m_config.m_width;
+
+                for (int x = x0 & ~3; x < x1; x += 4)
+                {
+                    __m128i const pixelX   = _mm_add_epi32(_mm_set1_epi32(x), laneIndex);
+                    __m128i const inRange  = _mm_andnot_si128(_mm_cmplt_epi32(pixelX, firstX), _mm_cmplt_epi32(pixelX, endX));
+                    __m128 const  notNearer = _mm_cmple_ps(_mm_loadu_ps(row + x), nearest);
+
+                    if (_mm_movemask_ps(_mm_and_ps(notNearer, _mm_castsi128_ps(inRange))) != 0)
+                    {
+                        return true;
+                    }
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------------------------------
+// 螢幕座標原點在左下，x 向右（相機 -J）、y 向上（相機 +K）
+//----------------------------------------------------------------------------------------------------
+bool OcclusionBuffer::ProjectToScreen(Vec3 const& worldPosition, float& outX, float& outY, float& outInverseDepth) const
+{
+    Vec3 const  toPoint = worldPosition - m_viewPosition;
+    float const depth   = DotProduct3D(toPoint, m_forward);
+
+    if (depth < m_nearZ)
+    {
+        return false;
+    }
+
+    outInverseDepth = 1.f / depth;
+    outX            = 0.5f * static_cast<float>(m_config.m_width) - DotProduct3D(toPoint, m_left) * outInverseDepth * m_screenScaleX;
+    outY            = 0.5f * static_cast<float>(m_config.m_height) + DotProduct3D(toPoint, m_up) * outInverseDepth * m_screenScaleY;
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// 邊 (a -> b) 的邊函數 E(p) = A * p.x + B * p.y + C 在逆時針輪廓內側為正；
+// 像素中心的 E >= (|A| + |B|) / 2 時，整個像素都在這條邊的內側。
+// 一次處理一列中的 4 個像素：tile 寬度是 4 的倍數，超出輪廓包圍盒的通道由邊函數排除，不會寫到其他 tile。
+//----------------------------------------------------------------------------------------------------
+void OcclusionBuffer::RasterizeTile(uint32_t const tileIndex)
+{
+    int const tileX0 = static_cast<int>((tileIndex % m_tileCountX) * m_config.m_tileWidth);
+    int const tileY0 = static_cast<int>((tileIndex / m_tileCountX) * m_config.m_tileHeight);
+    int const tileX1 = tileX0 + static_cast<int>(m_config.m_tileWidth);
+    int const tileY1 = tileY0 + static_cast<int>(m_config.m_tileHeight);
+
+    __m128 const laneOffsets = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+    __m128 const zero        = _mm_setzero_ps();
+
+    for (uint32_t const occluderIndex : m_tileOccluders[tileIndex])
+    {
+        sScreenOccluder const& occluder    = m_occluders[occluderIndex];
+        int const              vertexCount = static_cast<int>(occluder.m_vertexCount);
+
+        __m128 edgeA[MAX_SILHOUETTE_VERTEXES];
+        float  edgeB[MAX_SILHOUETTE_VERTEXES];
+        float  edgeC[MAX_SILHOUETTE_VERTEXES];
+        float  minX = FLT_MAX;
+        float  minY = FLT_MAX;
+        float  maxX = -FLT_MAX;
+        float  maxY = -FLT_MAX;
+
+        for (int edgeIndex = 0; edgeIndex < vertexCount; ++edgeIndex)
+        {
+            int const   a = edgeIndex;
+            int const   b = (edgeIndex + 1) % vertexCount;
+            float const A = occluder.m_y[a] - occluder.m_y[b];
+            float const B = occluder.m_x[b] - occluder.m_x[a];
+
+            edgeA[edgeIndex] = _mm_set1_ps(A);
+            edgeB[edgeIndex] = B;
+            edgeC[edgeIndex] = -(A * occluder.m_x[a] + B * occluder.m_y[a]) - 0.5f * (std::fabs(A) + std::fabs(B));
+
+            minX = std::min(minX, occluder.m_x[a]);
+            minY = std::min(minY, occluder.m_y[a]);
+            maxX = std::max(maxX, occluder.m_x[a]);
+            maxY = std::max(maxY, occluder.m_y[a]);
+        }
+
+        int const pixelX0 = std::max(static_cast<int>(std::floor(minX)), tileX0) & ~3;
+        int const pixelX1 = std::min(static_cast<int>(std::ceil(maxX)), tileX1);
+        int const pixelY0 = std::max(static_cast<int>(std::floor(minY)), tileY0);
+        int const pixelY1 = std::min(static_cast<int>(std::ceil(maxY)), tileY1);
+
+        __m128 const depth = _mm_set1_ps(occluder.m_inverseDepth);
+
+        for (int pixelY = pixelY0; pixelY < pixelY1; ++pixelY)
+        {
+            float const centerY = static_cast<float>(pixelY) + 0.5f;
+            float*      row     = m_inverseDepths.data() + static_cast<size_t>(pixelY) * m_config.m_width;
+
+            __m128 rowEdges[MAX_SILHOUETTE_VERTEXES];
+
+            for (int edgeIndex = 0; edgeIndex < vertexCount; ++edgeIndex)
+            {
+                rowEdges[edgeIndex] = _mm_set1_ps(edgeB[edgeIndex] * centerY + edgeC[edgeIndex]);
+            }
+
+            for (int pixelX = pixelX0; pixelX < pixelX1; pixelX += 4)
+            {
+                __m128 const centerX = _mm_add_ps(_mm_set1_ps(static_cast<float>(pixelX)), laneOffsets);
+                __m128       covered = _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(edgeA[0], centerX), rowEdges[0]), zero);
+
+                for (int edgeIndex = 1; edgeIndex < vertexCount; ++edgeIndex)
+                {
+                    covered = _mm_and_ps(covered, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(edgeA[edgeIndex], centerX), rowEdges[edgeIndex]), zero));
+                }
+
+                if (_mm_movemask_ps(covered) == 0)
+                {
+                    continue;
+                }
+
+                __m128 const current = _mm_loadu_ps(row + pixelX);
+                __m128 const nearer  = _mm_max_ps(current, depth);
+
+                _mm_storeu_ps(row + pixelX, _mm_or_ps(_mm_and_ps(covered, nearer), _mm_andnot_ps(covered, current)));
+            }
+        }
+    }
+
+    // 更新 tile 最遠的深度，供 IsAabbVisible 整個 tile 一次判定
+    __m128 tileMin = _mm_set1_ps(1e30f);
+
+    for (int pixelY = tileY0; pixelY < tileY1; ++pixelY)
+    {
+        float const* row = m_inverseDepths.data() + static_cast<size_t>(pixelY) * m_config.m_width;
+
+        for (int pixelX = tileX0; pixelX < tileX1; pixelX += 4)
+        {
+            tileMin = _mm_min_ps(tileMin, _mm_loadu_ps(row + pixelX));
+        }
+    }
+
+    alignas(16) float lanes[4];
+    _mm_store_ps(lanes, tileMin);
+
+    m_tileMinInverseDepths[tileIndex] = std::min({lanes[0], lanes[1], lanes[2], lanes[3]});
+}
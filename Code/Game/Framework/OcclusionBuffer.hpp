@@ -0,0 +1,81 @@
+//----------------------------------------------------------------------------------------------------
+// OcclusionBuffer.hpp
+// 軟體遮擋剔除 - 在低解析度的 CPU 深度緩衝區上以 SSE 光柵化遮擋物，再以螢幕空間包圍盒測試被遮擋物
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+#include "Engine/Math/AABB3.hpp"
+#include "Game/Framework/ViewFrustum.hpp"
+#include <cstdint>
+#include <vector>
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class JobSystem;
+struct Mat44;
+
+//----------------------------------------------------------------------------------------------------
+struct sOcclusionBufferConfig
+{
+    uint32_t m_width      = 256;   // 4 的倍數
+    uint32_t m_height     = 128;
+    uint32_t m_tileWidth  = 64;    // 4 的倍數，且整除 m_width
+    uint32_t m_tileHeight = 32;    // 整除 m_height
+};
+
+//----------------------------------------------------------------------------------------------------
+// 深度以 1 / 視線深度 存放（越大越近，清除為 0 = 無限遠）。
+//
+// 每幀：BeginFrame 設定相機並清除 → AddOccluderBox 加入遮擋物（把輪廓分配到重疊的 tile）→
+// Rasterize 每個 tile 各自光柵化分配到的輪廓（tile 之間不共用像素，可平行）→ IsAabbVisible 測試。
+//
+// 遮擋物的盒子以螢幕上的凸包輪廓、8 個角中最遠的深度光柵化，且只寫入完全在輪廓內的像素：
+// 寫入的每個像素在整個像素範圍內都確實被擋住，遮擋物之間小於一個像素的縫隙不會被填滿。
+// 跨越近平面的遮擋物直接捨棄，跨越近平面的被遮擋物一律視為可見；被遮擋物以 8 個角中最近的深度
+// 與螢幕矩形內每個像素比較，只有全部像素都更近時才判定被遮擋，因此結果是保守的。
+// 只依賴數學型別與 JobSystem（可為 nullptr），不需要 GPU。
+//----------------------------------------------------------------------------------------------------
+class OcclusionBuffer
+{
+public:
+    explicit OcclusionBuffer(sOcclusionBufferConfig const& config = {});
+
+    void BeginFrame(sPerspectiveView const& view);
+    void AddOccluderBox(Mat44 const& modelToWorld, AABB3 const& localBounds);
+    void Rasterize(JobSystem* jobSystem);
+    bool IsAabbVisible(AABB3 const& worldBounds) const;
+
+    uint32_t GetOccluderCount() const { return static_cast<uint32_t>(m_occluders.size()); }
+    uint32_t GetWidth() const { return m_config.m_width; }
+    uint32_t GetHeight() const { return m_config.m_height; }
+    float    GetInverseDepth(uint32_t x, uint32_t y) const { return m_inverseDepths[y * m_config.m_width + x]; }
+
+private:
+    static int constexpr MAX_SILHOUETTE_VERTEXES = 6;   // 盒子投影的凸包最多 6 個頂點
+
+    struct sScreenOccluder
+    {
+        float    m_x[MAX_SILHOUETTE_VERTEXES] = {};   // 逆時針（螢幕 y 向上）
+        float    m_y[MAX_SILHOUETTE_VERTEXES] = {};
+        uint32_t m_vertexCount                = 0;
+        float    m_inverseDepth               = 0.f;   // 最遠的角的深度，整個輪廓共用
+    };
+
+    bool ProjectToScreen(Vec3 const& worldPosition, float& outX, float& outY, float& outInverseDepth) const;
+    void RasterizeTile(uint32_t tileIndex);
+
+    sOcclusionBufferConfig             m_config;
+    uint32_t                           m_tileCountX = 0;
+    uint32_t                           m_tileCountY = 0;
+    std::vector<float>                 m_inverseDepths;
+    std::vector<float>                 m_tileMinInverseDepths;   // 每個 tile 最遠的深度；不小於被遮擋物最近深度時整個 tile 都遮住它
+    std::vector<sScreenOccluder>       m_occluders;
+    std::vector<std::vector<uint32_t>> m_tileOccluders;          // tile -> 與它重疊的遮擋物索引
+
+    Vec3  m_viewPosition;
+    Vec3  m_forward;
+    Vec3  m_left;
+    Vec3  m_up;
+    float m_nearZ        = 0.1f;
+    float m_screenScaleX = 1.f;   // 每單位（側向距離 / 深度）對應的像素數
+    float m_screenScaleY = 1.f;
+};
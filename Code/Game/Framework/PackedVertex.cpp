@@ -0,0 +1,337 @@
+//----------------------------------------------------------------------------------------------------
+// PackedVertex.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/PackedVertex.hpp"
+
+#include "Engine/Core/Vertex_PCU.hpp"
+#include "Engine/Core/Vertex_PCUTBN.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+//----------------------------------------------------------------------------------------------------
+static_assert(sizeof(sPackedVertex_PCUTBN) == 28, "sPackedVertex_PCUTBN must match the PACKED_VERTEX_FORMAT 1 input layout");
+static_assert(sizeof(sQuantizedVertex_PCUTBN) == 24, "sQuantizedVertex_PCUTBN must match the PACKED_VERTEX_FORMAT 2 input layout");
+static_assert(sizeof(sQuantizedVertex_PCU) == 16, "sQuantizedVertex_PCU must be tightly packed");
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    float constexpr SNORM16_MAX = 32767.f;
+
+    //------------------------------------------------------------------------------------------------
+    int16_t EncodeSnorm16(float const value)
+    {
+        return static_cast<int16_t>(std::lround(std::clamp(value, -1.f, 1.f) * SNORM16_MAX));
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // 與 GPU 的 SNORM 解碼相同：-32768 與 -32767 都是 -1
+    //------------------------------------------------------------------------------------------------
+    float DecodeSnorm16(int16_t const value)
+    {
+        return std::max(static_cast<float>(value) / SNORM16_MAX, -1.f);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // 投影到 |x| + |y| + |z| = 1 的八面體，下半球沿對角線摺到外側的四個三角形
+    //------------------------------------------------------------------------------------------------
+    void EncodeOctahedralCoordinates(Vec3 const& unitVector, float& outX, float& outY)
+    {
+        float const l1Norm = std::fabs(unitVector.x) + std::fabs(unitVector.y) + std::fabs(unitVector.z);
+
+        outX = 0.f;
+        outY = 0.f;
+
+        if (l1Norm <= 0.f)
+        {
+            return;
+        }
+
+        float const x = unitVector.x / l1Norm;
+        float const y = unitVector.y / l1Norm;
+
+        outX = unitVector.z < 0.f ? (1.f - std::fabs(y)) * (x >= 0.f ? 1.f : -1.f) : x;
+        outY = unitVector.z < 0.f ? (1.f - std::fabs(x)) * (y >= 0.f ? 1.f : -1.f) : y;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    Vec3 DecodeOctahedralCoordinates(float x, float y)
+    {
+        float const z      = 1.f - std::fabs(x) - std::fabs(y);
+        float const folded = std::max(-z, 0.f);
+
+        x += x >= 0.f ? -folded : folded;
+        y += y >= 0.f ? -folded : folded;
+
+        return Vec3(x, y, z).GetNormalized();
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // 切線的 y 映射到 [0, 32766] 後加 1，再依手性加上正負號；0 不會出現，解碼時正負號不會混淆
+    //------------------------------------------------------------------------------------------------
+    void EncodeTangentFrame(Vec3 const& tangent, Vec3 const& bitangent, Vec3 const& normal, int16_t outNormal[2], int16_t outTangent[2])
+    {
+        EncodeOctahedral(normal, outNormal);
+
+        float tangentX;
+        float tangentY;
+        EncodeOctahedralCoordinates(tangent, tangentX, tangentY);
+
+        int const  magnitude    = static_cast<int>(std::lround((std::clamp(tangentY, -1.f, 1.f) + 1.f) * 0.5f * (SNORM16_MAX - 1.f))) + 1;
+        bool const isLeftHanded = DotProduct3D(CrossProduct3D(normal, tangent), bitangent) < 0.f;
+
+        outTangent[0] = EncodeSnorm16(tangentX);
+        outTangent[1] = static_cast<int16_t>(isLeftHanded ? -magnitude : magnitude);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    void DecodeTangentFrame(int16_t const encodedNormal[2], int16_t const encodedTangent[2], Vertex_PCUTBN& outVertex)
+    {
+        int const   magnitude  = std::abs(static_cast<int>(encodedTangent[1]));
+        float const handedness = encodedTangent[1] < 0 ? -1.f : 1.f;
+        float const tangentY   = static_cast<float>(magnitude - 1) / (SNORM16_MAX - 1.f) * 2.f - 1.f;
+
+        // 與 BlinnPhong.hlsl 的 DecodePackedTangentFrame 相同
+        outVertex.m_normal    = DecodeOctahedral(encodedNormal);
+        outVertex.m_tangent   = DecodeOctahedralCoordinates(DecodeSnorm16(encodedTangent[0]), tangentY);
+        outVertex.m_bitangent = CrossProduct3D(outVertex.m_normal, outVertex.m_tangent) * handedness;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    template <typename VertexType>
+    sPositionQuantization ComputePositionQuantization(std::span<VertexType const> const vertexes)
+    {
+        sPositionQuantization quantization;
+
+        if (vertexes.empty())
+        {
+            return quantization;
+        }
+
+        Vec3 mins = vertexes.front().m_position;
+        Vec3 maxs = mins;
+
+        for (VertexType const& vertex : vertexes)
+        {
+            mins = Vec3(std::min(mins.x, vertex.m_position.x), std::min(mins.y, vertex.m_position.y), std::min(mins.z, vertex.m_position.z));
+            maxs = Vec3(std::max(maxs.x, vertex.m_position.x), std::max(maxs.y, vertex.m_position.y), std::max(maxs.z, vertex.m_position.z));
+        }
+
+        Vec3 const halfExtents = (maxs - mins) * 0.5f;
+
+        quantization.m_center = (mins + maxs) * 0.5f;
+        quantization.m_scale  = std::max({halfExtents.x, halfExtents.y, halfExtents.z});
+
+        if (quantization.m_scale <= 0.f)
+        {
+            quantization.m_scale = 1.f;
+        }
+
+        return quantization;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    void QuantizePosition(Vec3 const& position, sPositionQuantization const& quantization, int16_t outPosition[4])
+    {
+        float const inverseScale = 1.f / quantization.m_scale;
+
+        outPosition[0] = EncodeSnorm16((position.x - quantization.m_center.x) * inverseScale);
+        outPosition[1] = EncodeSnorm16((position.y - quantization.m_center.y) * inverseScale);
+        outPosition[2] = EncodeSnorm16((position.z - quantization.m_center.z) * inverseScale);
+        outPosition[3] = static_cast<int16_t>(SNORM16_MAX);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    Vec3 DequantizePosition(int16_t const position[4], sPositionQuantization const& quantization)
+    {
+        return quantization.m_center + Vec3(DecodeSnorm16(position[0]), DecodeSnorm16(position[1]), DecodeSnorm16(position[2])) * quantization.m_scale;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+Mat44 sPositionQuantization::GetDequantizeTransform() const
+{
+    Mat44 transform;
+    transform.SetIJKT3D(Vec3(m_scale, 0.f, 0.f), Vec3(0.f, m_scale, 0.f), Vec3(0.f, 0.f, m_scale), m_center);
+
+    return transform;
+}
+
+//----------------------------------------------------------------------------------------------------
+// 指數重新偏移後以整數加法完成捨入；次正規數借用浮點加法讓硬體完成對齊與捨入
+//----------------------------------------------------------------------------------------------------
+uint16_t FloatToHalf(float const value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    uint32_t const sign      = (bits >> 16) & 0x8000u;
+    uint32_t       magnitude = bits & 0x7FFFFFFFu;
+
+    if (magnitude >= 0x7F800000u)
+    {
+        return static_cast<uint16_t>(sign | 0x7C00u | (magnitude > 0x7F800000u ? 0x0200u : 0u));
+    }
+
+    // 65520 以上捨入後超過半精度的最大值 65504
+    if (magnitude >= 0x477FF000u)
+    {
+        return static_cast<uint16_t>(sign | 0x7C00u);
+    }
+
+    if (magnitude < 0x38800000u)
+    {
+        float subnormal;
+        std::memcpy(&subnormal, &magnitude, sizeof(subnormal));
+        subnormal += 0.5f;
+
+        uint32_t subnormalBits;
+        std::memcpy(&subnormalBits, &subnormal, sizeof(subnormalBits));
+
+        return static_cast<uint16_t>(sign | (subnormalBits - 0x3F000000u));
+    }
+
+    uint32_t const isMantissaOdd = (magnitude >> 13) & 1u;
+    magnitude += 0xC8000FFFu + isMantissaOdd;
+
+    return static_cast<uint16_t>(sign | (magnitude >> 13));
+}
+
+//----------------------------------------------------------------------------------------------------
+float HalfToFloat(uint16_t const half)
+{
+    uint32_t const sign     = static_cast<uint32_t>(half & 0x8000u) << 16;
+    uint32_t const exponent = (half >> 10) & 0x1Fu;
+    uint32_t const mantissa = half & 0x3FFu;
+
+    if (exponent == 0)
+    {
+        float const magnitude = std::ldexp(static_cast<float>(mantissa), -24);
+        return sign ? -magnitude : magnitude;
+    }
+
+    uint32_t const bits = exponent == 0x1Fu ? sign | 0x7F800000u | (mantissa << 13) : sign | ((exponent + 112u) << 23) | (mantissa << 13);
+
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+
+    return value;
+}
+
+//----------------------------------------------------------------------------------------------------
+void EncodeOctahedral(Vec3 const& unitVector, int16_t outEncoded[2])
+{
+    float x;
+    float y;
+    EncodeOctahedralCoordinates(unitVector, x, y);
+
+    outEncoded[0] = EncodeSnorm16(x);
+    outEncoded[1] = EncodeSnorm16(y);
+}
+
+//----------------------------------------------------------------------------------------------------
+Vec3 DecodeOctahedral(int16_t const encoded[2])
+{
+    return DecodeOctahedralCoordinates(DecodeSnorm16(encoded[0]), DecodeSnorm16(encoded[1]));
+}
+
+//----------------------------------------------------------------------------------------------------
+void PackVertexes(std::span<Vertex_PCUTBN const> const vertexes, std::vector<sPackedVertex_PCUTBN>& outVertexes)
+{
+    outVertexes.resize(vertexes.size());
+
+    for (size_t vertexIndex = 0; vertexIndex < vertexes.size(); ++vertexIndex)
+    {
+        Vertex_PCUTBN const&  source = vertexes[vertexIndex];
+        sPackedVertex_PCUTBN& packed = outVertexes[vertexIndex];
+
+        packed.m_position[0]    = source.m_position.x;
+        packed.m_position[1]    = source.m_position.y;
+        packed.m_position[2]    = source.m_position.z;
+        packed.m_color          = source.m_color;
+        packed.m_uvTexCoords[0] = FloatToHalf(source.m_uvTexCoords.x);
+        packed.m_uvTexCoords[1] = FloatToHalf(source.m_uvTexCoords.y);
+
+        EncodeTangentFrame(source.m_tangent, source.m_bitangent, source.m_normal, packed.m_normal, packed.m_tangent);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+sPositionQuantization QuantizeVertexes(std::span<Vertex_PCUTBN const> const vertexes, std::vector<sQuantizedVertex_PCUTBN>& outVertexes)
+{
+    sPositionQuantization const quantization = ComputePositionQuantization(vertexes);
+
+    outVertexes.resize(vertexes.size());
+
+    for (size_t vertexIndex = 0; vertexIndex < vertexes.size(); ++vertexIndex)
+    {
+        Vertex_PCUTBN const&     source    = vertexes[vertexIndex];
+        sQuantizedVertex_PCUTBN& quantized = outVertexes[vertexIndex];
+
+        QuantizePosition(source.m_position, quantization, quantized.m_position);
+        quantized.m_color          = source.m_color;
+        quantized.m_uvTexCoords[0] = FloatToHalf(source.m_uvTexCoords.x);
+        quantized.m_uvTexCoords[1] = FloatToHalf(source.m_uvTexCoords.y);
+
+        EncodeTangentFrame(source.m_tangent, source.m_bitangent, source.m_normal, quantized.m_normal, quantized.m_tangent);
+    }
+
+    return quantization;
+}
+
+//----------------------------------------------------------------------------------------------------
+sPositionQuantization QuantizeVertexes(std::span<Vertex_PCU const> const vertexes, std::vector<sQuantizedVertex_PCU>& outVertexes)
+{
+    sPositionQuantization const quantization = ComputePositionQuantization(vertexes);
+
+    outVertexes.resize(vertexes.size());
+
+    for (size_t vertexIndex = 0; vertexIndex < vertexes.size(); ++vertexIndex)
+    {
+        Vertex_PCU const&     source    = vertexes[vertexIndex];
+        sQuantizedVertex_PCU& quantized = outVertexes[vertexIndex];
+
+        QuantizePosition(source.m_position, quantization, quantized.m_position);
+        quantized.m_color          = source.m_color;
+        quantized.m_uvTexCoords[0] = FloatToHalf(source.m_uvTexCoords.x);
+        quantized.m_uvTexCoords[1] = FloatToHalf(source.m_uvTexCoords.y);
+    }
+
+    return quantization;
+}
+
+//----------------------------------------------------------------------------------------------------
+Vertex_PCUTBN UnpackVertex(sPackedVertex_PCUTBN const& vertex)
+{
+    Vertex_PCUTBN unpacked;
+    unpacked.m_position    = Vec3(vertex.m_position[0], vertex.m_position[1], vertex.m_position[2]);
+    unpacked.m_color       = vertex.m_color;
+    unpacked.m_uvTexCoords = Vec2(HalfToFloat(vertex.m_uvTexCoords[0]), HalfToFloat(vertex.m_uvTexCoords[1]));
+
+    DecodeTangentFrame(vertex.m_normal, vertex.m_tangent, unpacked);
+
+    return unpacked;
+}
+
+//----------------------------------------------------------------------------------------------------
+Vertex_PCUTBN UnpackVertex(sQuantizedVertex_PCUTBN const& vertex, sPositionQuantization const& quantization)
+{
+    Vertex_PCUTBN unpacked;
+    unpacked.m_position    = DequantizePosition(vertex.m_position, quantization);
+    unpacked.m_color       = vertex.m_color;
+    unpacked.m_uvTexCoords = Vec2(HalfToFloat(vertex.m_uvTexCoords[0]), HalfToFloat(vertex.m_uvTexCoords[1]));
+
+    DecodeTangentFrame(vertex.m_normal, vertex.m_tangent, unpacked);
+
+    return unpacked;
+}
+
+//----------------------------------------------------------------------------------------------------
+Vertex_PCU UnpackVertex(sQuantizedVertex_PCU const& vertex, sPositionQuantization const& quantization)
+{
+    return Vertex_PCU(DequantizePosition(vertex.m_position, quantization), vertex.m_color, Vec2(HalfToFloat(vertex.m_uvTexCoords[0]), HalfToFloat(vertex.m_uvTexCoords[1])));
+}
@@ -0,0 +1,86 @@
+//----------------------------------------------------------------------------------------------------
+// PackedVertex.hpp
+// 壓縮頂點格式 - 八面體編碼的法線與切線、半精度浮點 UV，以及可選的相對於 mesh 包圍盒的 16 位元位置
+// Engine 目前只建立 Vertex_PCU／Vertex_PCUTBN 的輸入佈局，這些格式尚未上傳到 GPU
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Math/Vec3.hpp"
+#include <cstdint>
+#include <span>
+#include <vector>
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+struct Vertex_PCU;
+struct Vertex_PCUTBN;
+
+//----------------------------------------------------------------------------------------------------
+// 對應 BlinnPhong.hlsl 的 PACKED_VERTEX_FORMAT 1，28 bytes（Vertex_PCUTBN 為 60 bytes）
+//
+// m_normal、m_tangent 是八面體編碼的單位向量（R16G16_SNORM）；副切線不儲存，由 cross(N, T) 乘上手性還原，
+// 手性折進 m_tangent[1]：正手性存 [1, 32767]、負手性存 [-32767, -1]，y 分量因此剩 15 位元精度。
+//----------------------------------------------------------------------------------------------------
+struct sPackedVertex_PCUTBN
+{
+    float    m_position[3]    = {};   // R32G32B32_FLOAT
+    Rgba8    m_color;                 // R8G8B8A8_UNORM
+    uint16_t m_uvTexCoords[2] = {};   // R16G16_FLOAT
+    int16_t  m_normal[2]      = {};   // R16G16_SNORM
+    int16_t  m_tangent[2]     = {};   // R16G16_SNORM
+};
+
+//----------------------------------------------------------------------------------------------------
+// 對應 PACKED_VERTEX_FORMAT 2，24 bytes；位置以 sPositionQuantization 映射到 [-1, 1] 後存成 R16G16B16A16_SNORM（w 固定為 1）
+//----------------------------------------------------------------------------------------------------
+struct sQuantizedVertex_PCUTBN
+{
+    int16_t  m_position[4]    = {};
+    Rgba8    m_color;
+    uint16_t m_uvTexCoords[2] = {};
+    int16_t  m_normal[2]      = {};
+    int16_t  m_tangent[2]     = {};
+};
+
+//----------------------------------------------------------------------------------------------------
+// 不打光的道具用，16 bytes（Vertex_PCU 為 24 bytes）
+//----------------------------------------------------------------------------------------------------
+struct sQuantizedVertex_PCU
+{
+    int16_t  m_position[4]    = {};
+    Rgba8    m_color;
+    uint16_t m_uvTexCoords[2] = {};
+};
+
+//----------------------------------------------------------------------------------------------------
+// 位置 = m_center + 解碼值 × m_scale。三個軸使用同一個縮放（包圍盒最長的半邊長），反量化矩陣只有等比縮放，
+// 乘進模型矩陣後法線與切線方向不變，shader 不需要額外的常數。
+//----------------------------------------------------------------------------------------------------
+struct sPositionQuantization
+{
+    Vec3  m_center;
+    float m_scale = 1.f;
+
+    Mat44 GetDequantizeTransform() const;
+};
+
+//----------------------------------------------------------------------------------------------------
+// 單一數值的編碼／解碼
+//----------------------------------------------------------------------------------------------------
+uint16_t FloatToHalf(float value);   // 就近捨入到偶數，超出範圍變成無限大，保留 NaN 與次正規數
+float    HalfToFloat(uint16_t half);
+
+void EncodeOctahedral(Vec3 const& unitVector, int16_t outEncoded[2]);
+Vec3 DecodeOctahedral(int16_t const encoded[2]);
+
+//----------------------------------------------------------------------------------------------------
+// 批次編碼與逐頂點解碼；切線框架假設正交，非正交的副切線解碼後會變成 cross(N, T) 的方向
+//----------------------------------------------------------------------------------------------------
+void                  PackVertexes(std::span<Vertex_PCUTBN const> vertexes, std::vector<sPackedVertex_PCUTBN>& outVertexes);
+sPositionQuantization QuantizeVertexes(std::span<Vertex_PCUTBN const> vertexes, std::vector<sQuantizedVertex_PCUTBN>& outVertexes);
+sPositionQuantization QuantizeVertexes(std::span<Vertex_PCU const> vertexes, std::vector<sQuantizedVertex_PCU>& outVertexes);
+
+Vertex_PCUTBN UnpackVertex(sPackedVertex_PCUTBN const& vertex);
+Vertex_PCUTBN UnpackVertex(sQuantizedVertex_PCUTBN const& vertex, sPositionQuantization const& quantization);
+Vertex_PCU    UnpackVertex(sQuantizedVertex_PCU const& vertex, sPositionQuantization const& quantization);
@@ -0,0 +1,45 @@
+//----------------------------------------------------------------------------------------------------
+// PowerPolicy.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/PowerPolicy.hpp"
+
+#include "Engine/Core/EngineCommon.hpp"
+
+//----------------------------------------------------------------------------------------------------
+PowerPolicy::PowerPolicy(sPowerPolicyConfig const& config)
+    : m_config(config)
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+void PowerPolicy::Update(bool const hasFocus, bool const isAttractMode, bool const isSceneStatic, bool const hadInput, double const nowSeconds)
+{
+    ePowerState const newState = !hasFocus ? ePowerState::UNFOCUSED : isAttractMode ? ePowerState::ATTRACT : ePowerState::ACTIVE;
+
+    m_hasStateChanged = !m_hasUpdated || newState != m_state;
+    m_hasUpdated      = true;
+    m_state           = newState;
+
+    bool const isRedrawDue = nowSeconds - m_lastRenderSeconds >= m_config.m_staticRedrawIntervalSeconds;
+
+    m_shouldRender = !GetSettings().m_skipStaticRedraws || !isSceneStatic || m_hasStateChanged || hadInput || isRedrawDue;
+
+    if (m_shouldRender)
+    {
+        m_lastRenderSeconds = nowSeconds;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC char const* PowerPolicy::GetStateName(ePowerState const state)
+{
+    switch (state)
+    {
+    case ePowerState::ACTIVE:    return "Active";
+    case ePowerState::ATTRACT:   return "Attract";
+    case ePowerState::UNFOCUSED: return "Unfocused";
+    default:                     return "Unknown";
+    }
+}
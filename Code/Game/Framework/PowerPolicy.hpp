@@ -0,0 +1,67 @@
+//----------------------------------------------------------------------------------------------------
+// PowerPolicy.hpp
+// 閒置節流策略 - 依視窗焦點與展示模式（attract）決定幀率、是否略過靜態畫面重繪、是否暫停腳本排程
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+//----------------------------------------------------------------------------------------------------
+enum class ePowerState : uint8_t
+{
+    ACTIVE,      // 有焦點且正在遊戲
+    ATTRACT,     // 有焦點，停在展示畫面
+    UNFOCUSED,   // 視窗失去焦點（不論遊戲狀態）
+    COUNT
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sPowerStateSettings
+{
+    float m_targetFps         = 60.f;
+    bool  m_isScriptPaused    = false;   // 暫停 ScriptTaskScheduler 的任務推進
+    bool  m_skipStaticRedraws = false;   // 畫面靜止時只在有輸入、狀態改變或達到重繪間隔時才繪製
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sPowerPolicyConfig
+{
+    std::array<sPowerStateSettings, static_cast<size_t>(ePowerState::COUNT)> m_settings = {{
+        {60.f, false, false},   // ACTIVE
+        {20.f, false, true},    // ATTRACT
+        {10.f, true, true},     // UNFOCUSED
+    }};
+
+    double m_staticRedrawIntervalSeconds = 1.0;   // 靜態畫面仍定期重繪（視窗被遮蔽後恢復等情況）
+};
+
+//----------------------------------------------------------------------------------------------------
+// 每幀在遊戲更新之後呼叫一次 Update；狀態改變時（HasStateChanged）由呼叫端把新設定套用到
+// FramePacer 與腳本排程器。非 ACTIVE 狀態下 FramePacer 應以可被輸入喚醒的方式等待，
+// 使用者一有輸入就立即執行下一幀，不必等到低幀率的下一個截止時間。
+//----------------------------------------------------------------------------------------------------
+class PowerPolicy
+{
+public:
+    explicit PowerPolicy(sPowerPolicyConfig const& config = {});
+
+    void Update(bool hasFocus, bool isAttractMode, bool isSceneStatic, bool hadInput, double nowSeconds);
+
+    ePowerState                GetState() const { return m_state; }
+    sPowerStateSettings const& GetSettings() const { return m_config.m_settings[static_cast<size_t>(m_state)]; }
+    bool                       HasStateChanged() const { return m_hasStateChanged; }
+    bool                       ShouldRender() const { return m_shouldRender; }
+    bool                       ShouldWakeOnInput() const { return m_state != ePowerState::ACTIVE; }
+
+    static char const* GetStateName(ePowerState state);
+
+private:
+    sPowerPolicyConfig m_config;
+    ePowerState        m_state             = ePowerState::ACTIVE;
+    bool               m_hasUpdated        = false;   // 第一次 Update 一律視為狀態改變，讓呼叫端套用初始設定
+    bool               m_hasStateChanged   = false;
+    bool               m_shouldRender      = true;
+    double             m_lastRenderSeconds = 0.0;
+};
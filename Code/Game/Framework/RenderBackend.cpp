@@ -0,0 +1,55 @@
+//----------------------------------------------------------------------------------------------------
+// RenderBackend.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/RenderBackend.hpp"
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Renderer/Renderer.hpp"
+#include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/MeshRegistry.hpp"
+
+//----------------------------------------------------------------------------------------------------
+void RendererBackend::BindMaterial(Shader* shader, Texture const* texture)
+{
+    g_theRenderer->BindShader(shader);
+    g_theRenderer->BindTexture(texture);
+}
+
+//----------------------------------------------------------------------------------------------------
+void RendererBackend::DrawInstances(uint32_t const meshId, sMeshEntry const& mesh, std::span<sInstanceData const> const instances)
+{
+    UNUSED(meshId);
+
+    for (sInstanceData const& instance : instances)
+    {
+        g_theRenderer->SetModelConstants(instance.m_modelToWorld, instance.m_tint);
+        MeshRegistry::Draw(mesh);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void RecordingRenderBackend::BindMaterial(Shader* shader, Texture const* texture)
+{
+    m_boundShader  = shader;
+    m_boundTexture = texture;
+    ++m_materialBindCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+void RecordingRenderBackend::DrawInstances(uint32_t const meshId, sMeshEntry const& mesh, std::span<sInstanceData const> const instances)
+{
+    UNUSED(mesh);
+
+    m_draws.push_back({m_boundShader, m_boundTexture, meshId, static_cast<uint32_t>(instances.size())});
+}
+
+//----------------------------------------------------------------------------------------------------
+void RecordingRenderBackend::Clear()
+{
+    m_draws.clear();
+    m_boundShader       = nullptr;
+    m_boundTexture      = nullptr;
+    m_materialBindCount = 0;
+}
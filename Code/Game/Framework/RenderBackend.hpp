@@ -0,0 +1,80 @@
+//----------------------------------------------------------------------------------------------------
+// RenderBackend.hpp
+// 批次繪製的後端介面 - RendererBackend 送往 g_theRenderer，RecordingRenderBackend 只記錄（無 GPU 環境可驗證繪製次數）
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include <cstdint>
+#include <span>
+#include <vector>
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class Shader;
+class Texture;
+struct sMeshEntry;
+
+//----------------------------------------------------------------------------------------------------
+// 每個實例的資料：模型矩陣與色調
+//----------------------------------------------------------------------------------------------------
+struct sInstanceData
+{
+    Mat44 m_modelToWorld;
+    Rgba8 m_tint = Rgba8::WHITE;
+};
+
+//----------------------------------------------------------------------------------------------------
+// InstanceBatcher 對每個批次呼叫一次 DrawInstances；材質（shader、貼圖）改變時才呼叫 BindMaterial
+//----------------------------------------------------------------------------------------------------
+class IRenderBackend
+{
+public:
+    virtual ~IRenderBackend() = default;
+
+    virtual void BindMaterial(Shader* shader, Texture const* texture) = 0;
+    virtual void DrawInstances(uint32_t meshId, sMeshEntry const& mesh, std::span<sInstanceData const> instances) = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Engine 的 Renderer 沒有 instanced draw，也無法綁定每個實例的頂點緩衝區，
+// 因此批次內的每個實例各自設定模型常數（矩陣與色調），再以 mesh 常駐的頂點／索引緩衝區繪製，
+// 每幀不上傳任何頂點。材質仍然每個批次只綁定一次。
+//----------------------------------------------------------------------------------------------------
+class RendererBackend : public IRenderBackend
+{
+public:
+    void BindMaterial(Shader* shader, Texture const* texture) override;
+    void DrawInstances(uint32_t meshId, sMeshEntry const& mesh, std::span<sInstanceData const> instances) override;
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sRecordedDraw
+{
+    Shader*        m_shader        = nullptr;
+    Texture const* m_texture       = nullptr;
+    uint32_t       m_meshId        = 0;
+    uint32_t       m_instanceCount = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// 不接觸 Renderer，只記錄每次繪製的材質、mesh 與實例數量
+//----------------------------------------------------------------------------------------------------
+class RecordingRenderBackend : public IRenderBackend
+{
+public:
+    void BindMaterial(Shader* shader, Texture const* texture) override;
+    void DrawInstances(uint32_t meshId, sMeshEntry const& mesh, std::span<sInstanceData const> instances) override;
+
+    void Clear();
+
+    std::span<sRecordedDraw const> GetDraws() const { return m_draws; }
+    size_t                         GetDrawCount() const { return m_draws.size(); }
+    size_t                         GetMaterialBindCount() const { return m_materialBindCount; }
+
+private:
+    std::vector<sRecordedDraw> m_draws;
+    Shader*                    m_boundShader       = nullptr;
+    Texture const*             m_boundTexture      = nullptr;
+    size_t                     m_materialBindCount = 0;
+};
@@ -0,0 +1,220 @@
+//----------------------------------------------------------------------------------------------------
+// RenderQueue.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/RenderQueue.hpp"
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Game/Framework/FrameProfiler.hpp"
+#include "Game/Framework/GameCommon.hpp"
+#include <algorithm>
+#include <array>
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    uint32_t constexpr DEPTH_BITS = 24;
+    uint32_t constexpr DEPTH_MAX  = (1u << DEPTH_BITS) - 1;
+}
+
+//----------------------------------------------------------------------------------------------------
+RenderQueue::RenderQueue(sRenderQueueConfig const& config)
+    : m_config(config)
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+void RenderQueue::Reset()
+{
+    m_commands.clear();
+    m_sortEntries.clear();
+    m_shaderIds.clear();
+    m_textureIds.clear();
+    m_stats = {};
+}
+
+//----------------------------------------------------------------------------------------------------
+void RenderQueue::Submit(eRenderPass const pass, sRenderState const& state, float const viewDepth, DrawFunc draw)
+{
+    uint64_t const key = MakeSortKey(pass, GetShaderId(state.m_shader), GetTextureId(state.m_texture), QuantizeDepth(pass, viewDepth));
+
+    m_sortEntries.push_back({key, static_cast<uint32_t>(m_commands.size())});
+    m_commands.push_back({state, std::move(draw)});
+}
+
+//----------------------------------------------------------------------------------------------------
+void RenderQueue::Execute()
+{
+    PROFILE_SCOPE("RenderQueue::Execute");
+
+    RadixSort();
+
+    for (size_t entryIndex = 0; entryIndex < m_sortEntries.size(); ++entryIndex)
+    {
+        sCommand const& command = m_commands[m_sortEntries[entryIndex].m_commandIndex];
+
+        ApplyState(command.m_state, entryIndex == 0);
+
+        if (command.m_draw)
+        {
+            command.m_draw();
+        }
+    }
+
+    m_stats.m_commandCount = static_cast<int>(m_commands.size());
+    m_lastStats            = m_stats;
+
+    Reset();
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC uint64_t RenderQueue::MakeSortKey(eRenderPass const pass, uint16_t const shaderId, uint16_t const textureId, uint32_t const depthBits)
+{
+    return (static_cast<uint64_t>(pass) & 0xF) << 60 |
+           static_cast<uint64_t>(shaderId) << 44 |
+           static_cast<uint64_t>(textureId) << 28 |
+           static_cast<uint64_t>(depthBits & DEPTH_MAX) << 4;
+}
+
+//----------------------------------------------------------------------------------------------------
+// 每幀的材質數量很少，線性搜尋即可；超過 16-bit 的 ID 共用最後一個值（只影響排序品質，不影響正確性）
+//----------------------------------------------------------------------------------------------------
+uint16_t RenderQueue::GetShaderId(Shader* shader)
+{
+    auto const found = std::find(m_shaderIds.begin(), m_shaderIds.end(), shader);
+
+    if (found != m_shaderIds.end())
+    {
+        return static_cast<uint16_t>(std::min<ptrdiff_t>(found - m_shaderIds.begin(), UINT16_MAX));
+    }
+
+    m_shaderIds.push_back(shader);
+    return static_cast<uint16_t>(std::min<size_t>(m_shaderIds.size() - 1, UINT16_MAX));
+}
+
+//----------------------------------------------------------------------------------------------------
+uint16_t RenderQueue::GetTextureId(Texture const* texture)
+{
+    if (!texture)
+    {
+        return 0;
+    }
+
+    auto const found = std::find(m_textureIds.begin(), m_textureIds.end(), texture);
+
+    if (found != m_textureIds.end())
+    {
+        return static_cast<uint16_t>(std::min<ptrdiff_t>(found - m_textureIds.begin() + 1, UINT16_MAX));
+    }
+
+    m_textureIds.push_back(texture);
+    return static_cast<uint16_t>(std::min<size_t>(m_textureIds.size(), UINT16_MAX));
+}
+
+//----------------------------------------------------------------------------------------------------
+uint32_t RenderQueue::QuantizeDepth(eRenderPass const pass, float const viewDepth) const
+{
+    float const    normalized = m_config.m_maxViewDepth > 0.f ? std::clamp(viewDepth / m_config.m_maxViewDepth, 0.f, 1.f) : 0.f;
+    uint32_t const depthBits  = static_cast<uint32_t>(normalized * static_cast<float>(DEPTH_MAX));
+
+    return pass == eRenderPass::WORLD_TRANSLUCENT ? DEPTH_MAX - depthBits : depthBits;
+}
+
+//----------------------------------------------------------------------------------------------------
+// LSD 基數排序，每次處理 8 bits；所有排序鍵在該位元組都相同時略過該趟（例如保留的低位元）
+//----------------------------------------------------------------------------------------------------
+void RenderQueue::RadixSort()
+{
+    size_t const numEntries = m_sortEntries.size();
+
+    if (numEntries < 2)
+    {
+        return;
+    }
+
+    m_sortScratch.resize(numEntries);
+
+    for (uint32_t shift = 0; shift < 64; shift += 8)
+    {
+        std::array<uint32_t, 256> counts = {};
+
+        for (sSortEntry const& entry : m_sortEntries)
+        {
+            ++counts[(entry.m_key >> shift) & 0xFF];
+        }
+
+        if (counts[(m_sortEntries.front().m_key >> shift) & 0xFF] == numEntries)
+        {
+            continue;
+        }
+
+        uint32_t offset = 0;
+        for (uint32_t& count : counts)
+        {
+            uint32_t const bucketSize = count;
+            count                     = offset;
+            offset += bucketSize;
+        }
+
+        for (sSortEntry const& entry : m_sortEntries)
+        {
+            m_sortScratch[counts[(entry.m_key >> shift) & 0xFF]++] = entry;
+        }
+
+        m_sortEntries.swap(m_sortScratch);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void RenderQueue::ApplyState(sRenderState const& state, bool const applyAll)
+{
+    auto applyIfChanged = [this, applyAll](bool const isDifferent, auto&& apply) {
+        if (applyAll || isDifferent)
+        {
+            apply();
+            ++m_stats.m_stateChangesApplied;
+        }
+        else
+        {
+            ++m_stats.m_stateChangesAvoided;
+        }
+    };
+
+    applyIfChanged(state.m_blendMode != m_currentState.m_blendMode, [&state] { g_theRenderer->SetBlendMode(state.m_blendMode); });
+    applyIfChanged(state.m_rasterizerMode != m_currentState.m_rasterizerMode, [&state] { g_theRenderer->SetRasterizerMode(state.m_rasterizerMode); });
+    applyIfChanged(state.m_samplerMode != m_currentState.m_samplerMode, [&state] { g_theRenderer->SetSamplerMode(state.m_samplerMode); });
+    applyIfChanged(state.m_depthMode != m_currentState.m_depthMode, [&state] { g_theRenderer->SetDepthMode(state.m_depthMode); });
+    applyIfChanged(state.m_shader != m_currentState.m_shader, [&state] { g_theRenderer->BindShader(state.m_shader); });
+    applyIfChanged(state.m_texture != m_currentState.m_texture, [&state] { g_theRenderer->BindTexture(state.m_texture); });
+
+    m_currentState = state;
+}
+
+//----------------------------------------------------------------------------------------------------
+RenderQueueBackend::RenderQueueBackend(RenderQueue& queue, IRenderBackend& target, eRenderPass const pass, sRenderState const& baseState)
+    : m_queue(queue),
+      m_target(target),
+      m_pass(pass),
+      m_state(baseState)
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+void RenderQueueBackend::BindMaterial(Shader* shader, Texture const* texture)
+{
+    m_state.m_shader  = shader;
+    m_state.m_texture = texture;
+}
+
+//----------------------------------------------------------------------------------------------------
+// 批次涵蓋許多位置不同的實例，沒有單一深度，排在同材質指令的最前面
+//----------------------------------------------------------------------------------------------------
+void RenderQueueBackend::DrawInstances(uint32_t const meshId, sMeshEntry const& mesh, std::span<sInstanceData const> const instances)
+{
+    IRenderBackend& target = m_target;
+
+    m_queue.Submit(m_pass, m_state, 0.f, [&target, meshId, &mesh, instances] {
+        target.DrawInstances(meshId, mesh, instances);
+    });
+}
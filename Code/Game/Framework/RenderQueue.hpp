@@ -0,0 +1,121 @@
+//----------------------------------------------------------------------------------------------------
+// RenderQueue.hpp
+// 排序式繪製佇列 - 以 64-bit 排序鍵（pass、shader、貼圖、深度）每幀基數排序，重播時只套用真正改變的繪製狀態
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+#include "Engine/Renderer/Renderer.hpp"
+#include "Game/Framework/RenderBackend.hpp"
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+enum class eRenderPass : uint8_t
+{
+    WORLD_OPAQUE,       // 由近到遠
+    WORLD_TRANSLUCENT,  // 由遠到近
+    COUNT
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sRenderState
+{
+    eBlendMode      m_blendMode      = eBlendMode::OPAQUE;
+    eRasterizerMode m_rasterizerMode = eRasterizerMode::SOLID_CULL_BACK;
+    eSamplerMode    m_samplerMode    = eSamplerMode::POINT_CLAMP;
+    eDepthMode      m_depthMode      = eDepthMode::READ_WRITE_LESS_EQUAL;
+    Shader*         m_shader         = nullptr;
+    Texture const*  m_texture        = nullptr;
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sRenderQueueConfig
+{
+    float m_maxViewDepth = 500.f;   // 超過此距離的深度全部量化成同一個值
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sRenderQueueStats
+{
+    int m_commandCount        = 0;
+    int m_stateChangesApplied = 0;
+    int m_stateChangesAvoided = 0;   // 與目前狀態相同而略過的設定次數
+};
+
+//----------------------------------------------------------------------------------------------------
+// 排序鍵（高位優先）：
+//   [63..60] pass
+//   [59..44] shader ID（每幀依首次出現順序配發）
+//   [43..28] 貼圖 ID（nullptr 為 0）
+//   [27.. 4] 量化後的深度（透明 pass 反轉，使遠的先畫）
+//   [ 3.. 0] 保留
+//
+// 每幀流程：Reset -> Submit（任意順序）-> Execute。
+// Execute 的第一個指令一律套用全部狀態（佇列外的程式碼可能改過 Renderer 的狀態），
+// 之後每個欄位只在與上一個指令不同時才呼叫 Renderer。
+//----------------------------------------------------------------------------------------------------
+class RenderQueue
+{
+public:
+    using DrawFunc = std::function<void()>;
+
+    explicit RenderQueue(sRenderQueueConfig const& config = {});
+
+    void Reset();
+    void Submit(eRenderPass pass, sRenderState const& state, float viewDepth, DrawFunc draw);
+    void Execute();
+
+    sRenderQueueStats const& GetLastStats() const { return m_lastStats; }
+    size_t                   GetCommandCount() const { return m_commands.size(); }
+
+    static uint64_t MakeSortKey(eRenderPass pass, uint16_t shaderId, uint16_t textureId, uint32_t depthBits);
+
+private:
+    struct sCommand
+    {
+        sRenderState m_state;
+        DrawFunc     m_draw;
+    };
+
+    struct sSortEntry
+    {
+        uint64_t m_key          = 0;
+        uint32_t m_commandIndex = 0;
+    };
+
+    uint16_t GetShaderId(Shader* shader);
+    uint16_t GetTextureId(Texture const* texture);
+    uint32_t QuantizeDepth(eRenderPass pass, float viewDepth) const;
+    void     RadixSort();
+    void     ApplyState(sRenderState const& state, bool applyAll);
+
+    sRenderQueueConfig          m_config;
+    std::vector<sCommand>       m_commands;
+    std::vector<sSortEntry>     m_sortEntries;
+    std::vector<sSortEntry>     m_sortScratch;
+    std::vector<Shader*>        m_shaderIds;
+    std::vector<Texture const*> m_textureIds;
+    sRenderState                m_currentState;
+    sRenderQueueStats           m_stats;
+    sRenderQueueStats           m_lastStats;
+};
+
+//----------------------------------------------------------------------------------------------------
+// 把 InstanceBatcher 的批次轉成佇列指令：BindMaterial 只記錄材質，DrawInstances 延後到 Execute 時
+// 交給 target 繪製。mesh 與實例資料以參考保存，Execute 前不可重建批次器或修改登錄表。
+//----------------------------------------------------------------------------------------------------
+class RenderQueueBackend : public IRenderBackend
+{
+public:
+    RenderQueueBackend(RenderQueue& queue, IRenderBackend& target, eRenderPass pass, sRenderState const& baseState);
+
+    void BindMaterial(Shader* shader, Texture const* texture) override;
+    void DrawInstances(uint32_t meshId, sMeshEntry const& mesh, std::span<sInstanceData const> instances) override;
+
+private:
+    RenderQueue&    m_queue;
+    IRenderBackend& m_target;
+    eRenderPass     m_pass;
+    sRenderState    m_state;
+};
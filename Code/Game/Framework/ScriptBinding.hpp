@@ -0,0 +1,594 @@
+//----------------------------------------------------------------------------------------------------
+// ScriptBinding.hpp
+// 編譯期腳本綁定層 - 由 C++ 成員函式簽章自動產生型別化的呼叫轉接器
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Math/Vec3.hpp"
+#include "Engine/Scripting/IScriptableObject.hpp"
+#include "Game/Framework/EntityHandle.hpp"
+#include "Game/Framework/ScriptCallProfiler.hpp"
+#include <any>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+// 數值轉換：使用指標版 any_cast，型別不符時只回傳 nullptr，不會拋出 bad_any_cast。
+// V8 數值通常以 double 傳入，所以先檢查 double。
+//----------------------------------------------------------------------------------------------------
+inline bool ConvertScriptNumber(std::any const& arg, double& out)
+{
+    if (double const* value = std::any_cast<double>(&arg))
+    {
+        out = *value;
+        return true;
+    }
+    if (int const* value = std::any_cast<int>(&arg))
+    {
+        out = static_cast<double>(*value);
+        return true;
+    }
+    if (float const* value = std::any_cast<float>(&arg))
+    {
+        out = static_cast<double>(*value);
+        return true;
+    }
+    if (bool const* value = std::any_cast<bool>(&arg))
+    {
+        out = *value ? 1.0 : 0.0;
+        return true;
+    }
+    return false;
+}
+
+//----------------------------------------------------------------------------------------------------
+// JavaScript 數值（double）收窄為 C++ 型別：NaN、無限大與超出 T 範圍的值回傳 false，
+// 避免 static_cast 的未定義行為。整數型別的小數部分直接截去（與 JS 的 Math.trunc 相同）。
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+bool NarrowScriptNumber(double const value, T& out)
+{
+    if (!std::isfinite(value))
+    {
+        return false;
+    }
+
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        if (std::fabs(value) > static_cast<double>(std::numeric_limits<T>::max())) return false;
+    }
+    else
+    {
+        if (value <= static_cast<double>(std::numeric_limits<T>::min()) - 1.0 ||
+            value >= static_cast<double>(std::numeric_limits<T>::max()) + 1.0) return false;
+    }
+
+    out = static_cast<T>(value);
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// JavaScript 陣列（一般 Array）轉為數值陣列；只有在無法零複製時才會走到這裡
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+bool ConvertScriptNumberArray(std::any const& arg, std::vector<T>& out)
+{
+    if (std::vector<double> const* values = std::any_cast<std::vector<double>>(&arg))
+    {
+        out.resize(values->size());
+        for (size_t index = 0; index < values->size(); ++index)
+        {
+            if (!NarrowScriptNumber((*values)[index], out[index])) return false;
+        }
+        return true;
+    }
+    if (std::vector<std::any> const* values = std::any_cast<std::vector<std::any>>(&arg))
+    {
+        out.resize(values->size());
+        for (size_t index = 0; index < values->size(); ++index)
+        {
+            double value = 0.0;
+            if (!ConvertScriptNumber((*values)[index], value)) return false;
+            if (!NarrowScriptNumber(value, out[index])) return false;
+        }
+        return true;
+    }
+    return false;
+}
+
+//----------------------------------------------------------------------------------------------------
+// TypedArray 的 backing store 視圖。
+// V8Subsystem 若直接提供 Float32Array / Uint8Array 的記憶體位址，就以此型別放入 std::any，
+// 綁定層會直接讀取該記憶體，不逐一封裝元素。
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+struct sScriptTypedArray
+{
+    T const* m_data  = nullptr;
+    size_t   m_count = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// ScriptArgTraits<T>
+//  ARG_COUNT : 此型別會消耗幾個 JavaScript 參數（Vec3 = x, y, z 三個）
+//  Convert   : 從 args[offset] 開始轉換，成功時 offset 前進 ARG_COUNT
+//  Storage   : （選用）轉換時需要暫存資料的型別，由綁定層在呼叫期間持有
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+struct ScriptArgTraits;
+
+template <>
+struct ScriptArgTraits<float>
+{
+    static constexpr size_t ARG_COUNT = 1;
+
+    static bool Convert(std::vector<std::any> const& args, size_t& offset, float& out)
+    {
+        double value = 0.0;
+        if (!ConvertScriptNumber(args[offset], value)) return false;
+        if (!NarrowScriptNumber(value, out)) return false;
+        ++offset;
+        return true;
+    }
+
+    static void AppendTypeNames(std::vector<std::string>& names) { names.emplace_back("float"); }
+};
+
+template <>
+struct ScriptArgTraits<int>
+{
+    static constexpr size_t ARG_COUNT = 1;
+
+    static bool Convert(std::vector<std::any> const& args, size_t& offset, int& out)
+    {
+        double value = 0.0;
+        if (!ConvertScriptNumber(args[offset], value)) return false;
+        if (!NarrowScriptNumber(value, out)) return false;
+        ++offset;
+        return true;
+    }
+
+    static void AppendTypeNames(std::vector<std::string>& names) { names.emplace_back("int"); }
+};
+
+template <>
+struct ScriptArgTraits<bool>
+{
+    static constexpr size_t ARG_COUNT = 1;
+
+    static bool Convert(std::vector<std::any> const& args, size_t& offset, bool& out)
+    {
+        double value = 0.0;
+        if (!ConvertScriptNumber(args[offset], value)) return false;
+        out = value != 0.0 && !std::isnan(value); // 與 JS 相同，NaN 為 false
+        ++offset;
+        return true;
+    }
+
+    static void AppendTypeNames(std::vector<std::string>& names) { names.emplace_back("bool"); }
+};
+
+template <>
+struct ScriptArgTraits<sEntityHandle>
+{
+    static constexpr size_t ARG_COUNT = 1;
+
+    static bool Convert(std::vector<std::any> const& args, size_t& offset, sEntityHandle& out)
+    {
+        // 控制代碼必須是原樣傳回的整數，帶小數的值一定不是由 createCube 產生的
+        double value = 0.0;
+        if (!ConvertScriptNumber(args[offset], value)) return false;
+        if (std::trunc(value) != value) return false;
+        if (!NarrowScriptNumber(value, out.m_value)) return false;
+        ++offset;
+        return true;
+    }
+
+    static void AppendTypeNames(std::vector<std::string>& names) { names.emplace_back("handle"); }
+};
+
+template <>
+struct ScriptArgTraits<std::string>
+{
+    static constexpr size_t ARG_COUNT = 1;
+
+    static bool Convert(std::vector<std::any> const& args, size_t& offset, std::string& out)
+    {
+        if (std::string const* value = std::any_cast<std::string>(&args[offset]))
+        {
+            out = *value;
+        }
+        else if (char const* const* cstr = std::any_cast<char const*>(&args[offset]))
+        {
+            out = *cstr;
+        }
+        else
+        {
+            return false;
+        }
+        ++offset;
+        return true;
+    }
+
+    static void AppendTypeNames(std::vector<std::string>& names) { names.emplace_back("string"); }
+};
+
+template <>
+struct ScriptArgTraits<Vec3>
+{
+    static constexpr size_t ARG_COUNT = 3;
+
+    static bool Convert(std::vector<std::any> const& args, size_t& offset, Vec3& out)
+    {
+        return ScriptArgTraits<float>::Convert(args, offset, out.x) &&
+               ScriptArgTraits<float>::Convert(args, offset, out.y) &&
+               ScriptArgTraits<float>::Convert(args, offset, out.z);
+    }
+
+    static void AppendTypeNames(std::vector<std::string>& names) { names.insert(names.end(), {"float", "float", "float"}); }
+};
+
+template <>
+struct ScriptArgTraits<std::span<float const>>
+{
+    static constexpr size_t ARG_COUNT = 1;
+    using Storage = std::vector<float>;
+
+    static bool Convert(std::vector<std::any> const& args, size_t& offset, std::span<float const>& out, Storage& storage)
+    {
+        std::any const& arg = args[offset];
+        if (sScriptTypedArray<float> const* typedArray = std::any_cast<sScriptTypedArray<float>>(&arg))
+        {
+            out = std::span<float const>(typedArray->m_data, typedArray->m_count);
+        }
+        else if (std::vector<float> const* floats = std::any_cast<std::vector<float>>(&arg))
+        {
+            out = *floats; // 直接指向 args 內的資料，呼叫期間有效
+        }
+        else if (ConvertScriptNumberArray(arg, storage))
+        {
+            out = storage;
+        }
+        else
+        {
+            return false;
+        }
+        ++offset;
+        return true;
+    }
+
+    static void AppendTypeNames(std::vector<std::string>& names) { names.emplace_back("Float32Array"); }
+};
+
+template <>
+struct ScriptArgTraits<std::span<Rgba8 const>>
+{
+    static_assert(sizeof(Rgba8) == 4, "Rgba8 must be tightly packed RGBA bytes");
+
+    static constexpr size_t ARG_COUNT = 1;
+    using Storage = std::vector<uint8_t>;
+
+    static bool Convert(std::vector<std::any> const& args, size_t& offset, std::span<Rgba8 const>& out, Storage& storage)
+    {
+        std::any const& arg = args[offset];
+        uint8_t const*  bytes = nullptr;
+        size_t          count = 0;
+
+        if (sScriptTypedArray<uint8_t> const* typedArray = std::any_cast<sScriptTypedArray<uint8_t>>(&arg))
+        {
+            bytes = typedArray->m_data;
+            count = typedArray->m_count;
+        }
+        else if (std::vector<uint8_t> const* byteVector = std::any_cast<std::vector<uint8_t>>(&arg))
+        {
+            bytes = byteVector->data();
+            count = byteVector->size();
+        }
+        else if (ConvertScriptNumberArray(arg, storage))
+        {
+            bytes = storage.data();
+            count = storage.size();
+        }
+        else
+        {
+            return false;
+        }
+
+        // Uint8Array 每 4 個位元組（RGBA）為一個顏色；長度不是 4 的倍數時視為參數錯誤，不默默捨棄尾端
+        if (count % 4 != 0)
+        {
+            return false;
+        }
+
+        out = std::span<Rgba8 const>(reinterpret_cast<Rgba8 const*>(bytes), count / 4);
+        ++offset;
+        return true;
+    }
+
+    static void AppendTypeNames(std::vector<std::string>& names) { names.emplace_back("Uint8Array"); }
+};
+
+//----------------------------------------------------------------------------------------------------
+// 取出 ScriptArgTraits<T>::Storage；沒有定義時使用空型別
+//----------------------------------------------------------------------------------------------------
+struct sScriptNoStorage
+{
+};
+
+template <typename T>
+struct ScriptArgStorageOf
+{
+    using Type = sScriptNoStorage;
+};
+
+template <typename T>
+    requires requires { typename ScriptArgTraits<T>::Storage; }
+struct ScriptArgStorageOf<T>
+{
+    using Type = typename ScriptArgTraits<T>::Storage;
+};
+
+template <typename Tuple>
+struct ScriptArgStorageTuple;
+
+template <typename... Ts>
+struct ScriptArgStorageTuple<std::tuple<Ts...>>
+{
+    using Type = std::tuple<typename ScriptArgStorageOf<Ts>::Type...>;
+};
+
+//----------------------------------------------------------------------------------------------------
+// ScriptReturnTraits<R>：C++ 回傳值轉為 ScriptMethodResult 可攜帶的 std::any
+//----------------------------------------------------------------------------------------------------
+template <typename R>
+struct ScriptReturnTraits
+{
+    static std::any ToScript(R const& value) { return value; }
+    static char const* GetTypeName() { return "object"; }
+};
+
+template <>
+struct ScriptReturnTraits<bool>
+{
+    static std::any ToScript(bool value) { return value; }
+    static char const* GetTypeName() { return "bool"; }
+};
+
+template <>
+struct ScriptReturnTraits<sEntityHandle>
+{
+    static std::any ToScript(sEntityHandle value) { return static_cast<double>(value.m_value); }
+    static char const* GetTypeName() { return "handle"; }
+};
+
+//----------------------------------------------------------------------------------------------------
+// 多個控制代碼以 uint32_t 陣列回傳，由 V8Subsystem 包裝成 Uint32Array（不逐一封裝成 Number）
+//----------------------------------------------------------------------------------------------------
+template <>
+struct ScriptReturnTraits<std::vector<sEntityHandle>>
+{
+    static std::any ToScript(std::vector<sEntityHandle> const& values)
+    {
+        std::vector<uint32_t> handleValues(values.size());
+        for (size_t index = 0; index < values.size(); ++index)
+        {
+            handleValues[index] = values[index].m_value;
+        }
+        return handleValues;
+    }
+
+    static char const* GetTypeName() { return "Uint32Array"; }
+};
+
+template <>
+struct ScriptReturnTraits<std::string>
+{
+    static std::any ToScript(std::string const& value) { return value; }
+    static char const* GetTypeName() { return "string"; }
+};
+
+template <>
+struct ScriptReturnTraits<Vec3>
+{
+    // 維持原本 getPlayerPosition 的字串格式，讓腳本端不需修改
+    static std::any ToScript(Vec3 const& value)
+    {
+        return "{ x: " + std::to_string(value.x) +
+               ", y: " + std::to_string(value.y) +
+               ", z: " + std::to_string(value.z) + " }";
+    }
+
+    static char const* GetTypeName() { return "object"; }
+};
+
+//----------------------------------------------------------------------------------------------------
+// 成員函式指標的型別拆解
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+struct ScriptMemberTraits;
+
+template <typename C, typename R, typename... Args>
+struct ScriptMemberTraits<R (C::*)(Args...)>
+{
+    using Class    = C;
+    using Return   = R;
+    using ArgTuple = std::tuple<std::remove_cvref_t<Args>...>;
+};
+
+template <typename C, typename R, typename... Args>
+struct ScriptMemberTraits<R (C::*)(Args...) const> : ScriptMemberTraits<R (C::*)(Args...)>
+{
+    using Class = C const;
+};
+
+//----------------------------------------------------------------------------------------------------
+template <typename Class>
+using ScriptMethodInvoker = ScriptMethodResult (*)(Class& object, std::vector<std::any> const& args, char const* methodName, size_t minArgCount, uint64_t* outConversionNs);
+
+//----------------------------------------------------------------------------------------------------
+// ScriptMethodBinder<&Class::Method>
+// 每個綁定的方法在編譯期產生一個專屬的 Invoke：參數數量檢查、逐一直接轉型、呼叫、包裝回傳值。
+// 正常路徑上不經過字串比對，也不會拋出例外。
+// minArgCount 小於 ARG_COUNT 時，尾端省略的參數維持其預設建構值（例如空的 span）。
+// outConversionNs 非空時（分析器啟用中）另外量測參數轉型所花的時間。
+//----------------------------------------------------------------------------------------------------
+template <auto Method>
+struct ScriptMethodBinder
+{
+    using Traits       = ScriptMemberTraits<decltype(Method)>;
+    using Class        = std::remove_const_t<typename Traits::Class>;
+    using Return       = typename Traits::Return;
+    using ArgTuple     = typename Traits::ArgTuple;
+    using StorageTuple = typename ScriptArgStorageTuple<ArgTuple>::Type;
+
+    static constexpr size_t NUM_PARAMS = std::tuple_size_v<ArgTuple>;
+    static constexpr size_t ARG_COUNT  = []<size_t... I>(std::index_sequence<I...>) {
+        return (size_t{0} + ... + ScriptArgTraits<std::tuple_element_t<I, ArgTuple>>::ARG_COUNT);
+    }(std::make_index_sequence<NUM_PARAMS>{});
+
+    static ScriptMethodResult Invoke(Class& object, std::vector<std::any> const& args, char const* methodName, size_t minArgCount, uint64_t* outConversionNs)
+    {
+        if (args.size() < minArgCount || args.size() > ARG_COUNT)
+        {
+            std::ostringstream oss;
+            oss << methodName << " 需要 ";
+            if (minArgCount == ARG_COUNT) oss << ARG_COUNT;
+            else oss << minArgCount << "-" << ARG_COUNT;
+            oss << " 個參數，但收到 " << args.size() << " 個";
+            return ScriptMethodResult::Error(oss.str());
+        }
+
+        uint64_t const conversionStartNs = outConversionNs ? ScriptCallProfiler::GetTimeNs() : 0;
+
+        ArgTuple     values;
+        StorageTuple storage;
+        bool const   isConverted = ConvertArgs(args, values, storage, std::make_index_sequence<NUM_PARAMS>{});
+
+        if (outConversionNs)
+        {
+            *outConversionNs = ScriptCallProfiler::GetTimeNs() - conversionStartNs;
+        }
+
+        if (!isConverted)
+        {
+            return ScriptMethodResult::Error(std::string(methodName) + " 參數類型錯誤");
+        }
+
+        return Call(object, values, std::make_index_sequence<NUM_PARAMS>{});
+    }
+
+    static std::vector<std::string> GetArgTypeNames()
+    {
+        std::vector<std::string> names;
+        [&names]<size_t... I>(std::index_sequence<I...>) {
+            (ScriptArgTraits<std::tuple_element_t<I, ArgTuple>>::AppendTypeNames(names), ...);
+        }(std::make_index_sequence<NUM_PARAMS>{});
+        return names;
+    }
+
+    static char const* GetReturnTypeName()
+    {
+        if constexpr (std::is_void_v<Return>)
+        {
+            return "void";
+        }
+        else
+        {
+            return ScriptReturnTraits<std::remove_cvref_t<Return>>::GetTypeName();
+        }
+    }
+
+private:
+    template <size_t... I>
+    static bool ConvertArgs([[maybe_unused]] std::vector<std::any> const& args,
+                            [[maybe_unused]] ArgTuple&                    values,
+                            [[maybe_unused]] StorageTuple&                storage,
+                            std::index_sequence<I...>)
+    {
+        [[maybe_unused]] size_t offset = 0;
+        return (ConvertArg<std::tuple_element_t<I, ArgTuple>>(args, offset, std::get<I>(values), std::get<I>(storage)) && ...);
+    }
+
+    template <typename T, typename Storage>
+    static bool ConvertArg(std::vector<std::any> const& args, size_t& offset, T& out, Storage& storage)
+    {
+        using ArgTraits = ScriptArgTraits<T>;
+
+        if (offset == args.size())
+        {
+            return true; // 省略的尾端參數（數量已由 Invoke 檢查）
+        }
+        if (offset + ArgTraits::ARG_COUNT > args.size())
+        {
+            return false;
+        }
+
+        if constexpr (std::is_same_v<Storage, sScriptNoStorage>)
+        {
+            return ArgTraits::Convert(args, offset, out);
+        }
+        else
+        {
+            return ArgTraits::Convert(args, offset, out, storage);
+        }
+    }
+
+    template <size_t... I>
+    static ScriptMethodResult Call(Class& object, [[maybe_unused]] ArgTuple& values, std::index_sequence<I...>)
+    {
+        if constexpr (std::is_void_v<Return>)
+        {
+            (object.*Method)(std::get<I>(values)...);
+            return ScriptMethodResult::Success();
+        }
+        else
+        {
+            return ScriptMethodResult::Success(ScriptReturnTraits<std::remove_cvref_t<Return>>::ToScript((object.*Method)(std::get<I>(values)...)));
+        }
+    }
+};
+
+//----------------------------------------------------------------------------------------------------
+// 綁定表的單筆資料；由 BindScriptMethod<&Class::Method>() 產生
+//----------------------------------------------------------------------------------------------------
+template <typename Class>
+struct sScriptMethodBinding
+{
+    char const*                 m_name        = nullptr;
+    char const*                 m_description = nullptr;
+    ScriptMethodInvoker<Class>  m_invoker     = nullptr;
+    std::vector<std::string>    m_argTypes;
+    char const*                 m_returnType  = nullptr;
+    size_t                      m_minArgCount = 0;
+    uint32_t                    m_profileSlot = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// minArgCount 預設為全部參數都必須提供
+//----------------------------------------------------------------------------------------------------
+template <auto Method>
+sScriptMethodBinding<typename ScriptMethodBinder<Method>::Class> BindScriptMethod(char const* name,
+                                                                                  char const* description,
+                                                                                  size_t      minArgCount = ScriptMethodBinder<Method>::ARG_COUNT)
+{
+    using Binder = ScriptMethodBinder<Method>;
+
+    sScriptMethodBinding<typename Binder::Class> binding;
+    binding.m_name        = name;
+    binding.m_description = description;
+    binding.m_invoker     = &Binder::Invoke;
+    binding.m_argTypes    = Binder::GetArgTypeNames();
+    binding.m_returnType  = Binder::GetReturnTypeName();
+    binding.m_minArgCount = minArgCount;
+    binding.m_profileSlot = ScriptCallProfiler::RegisterEntry(name);
+    return binding;
+}
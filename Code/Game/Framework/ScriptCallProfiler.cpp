@@ -0,0 +1,155 @@
+//----------------------------------------------------------------------------------------------------
+// ScriptCallProfiler.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/ScriptCallProfiler.hpp"
+
+#include "Engine/Core/DevConsole.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include <algorithm>
+#include <fstream>
+
+//----------------------------------------------------------------------------------------------------
+STATIC uint32_t ScriptCallProfiler::RegisterEntry(std::string const& name)
+{
+    std::vector<sScriptCallStats>& entries = GetEntries();
+
+    for (size_t slot = 0; slot < entries.size(); ++slot)
+    {
+        if (entries[slot].m_name == name)
+        {
+            return static_cast<uint32_t>(slot);
+        }
+    }
+
+    entries.push_back({name});
+    return static_cast<uint32_t>(entries.size() - 1);
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC void ScriptCallProfiler::Record(uint32_t const slot, uint64_t const totalNs, uint64_t const conversionNs)
+{
+    sScriptCallStats& stats = GetEntries()[slot];
+
+    ++stats.m_callCount;
+    stats.m_totalNs += totalNs;
+    stats.m_maxNs = std::max(stats.m_maxNs, totalNs);
+    stats.m_conversionNs += conversionNs;
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC void ScriptCallProfiler::Reset()
+{
+    for (sScriptCallStats& stats : GetEntries())
+    {
+        stats = {stats.m_name};
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC std::vector<sScriptCallStats> ScriptCallProfiler::GetStatsSortedByTotalTime()
+{
+    std::vector<sScriptCallStats> sortedStats = GetEntries();
+
+    std::sort(sortedStats.begin(), sortedStats.end(), [](sScriptCallStats const& a, sScriptCallStats const& b) {
+        return a.m_totalNs > b.m_totalNs;
+    });
+
+    return sortedStats;
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC bool ScriptCallProfiler::DumpToJson(std::string const& filePath)
+{
+    std::ofstream file(filePath, std::ios::trunc);
+    if (!file)
+    {
+        return false;
+    }
+
+    std::vector<sScriptCallStats> const sortedStats = GetStatsSortedByTotalTime();
+
+    file << "{\n  \"entries\": [\n";
+
+    for (size_t index = 0; index < sortedStats.size(); ++index)
+    {
+        sScriptCallStats const& stats = sortedStats[index];
+
+        file << "    { \"name\": \"" << stats.m_name << "\""
+             << ", \"callCount\": " << stats.m_callCount
+             << ", \"totalNs\": " << stats.m_totalNs
+             << ", \"maxNs\": " << stats.m_maxNs
+             << ", \"avgNs\": " << (stats.m_callCount > 0 ? stats.m_totalNs / stats.m_callCount : 0)
+             << ", \"conversionNs\": " << stats.m_conversionNs
+             << " }" << (index + 1 < sortedStats.size() ? ",\n" : "\n");
+    }
+
+    file << "  ]\n}\n";
+
+    return static_cast<bool>(file);
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC bool ScriptCallProfiler::OnScriptProfileCommand(EventArgs& args)
+{
+    if (!g_theDevConsole)
+    {
+        return false;
+    }
+
+    std::string const enable   = args.GetValue("enable", std::string());
+    std::string const dumpPath = args.GetValue("dump", std::string());
+    bool const        reset    = args.GetValue("reset", false);
+
+    if (!enable.empty())
+    {
+        SetEnabled(enable == "true");
+        g_theDevConsole->AddLine(DevConsole::INFO_MINOR, IsEnabled() ? "Script profiler enabled" : "Script profiler disabled");
+    }
+
+    if (reset)
+    {
+        Reset();
+        g_theDevConsole->AddLine(DevConsole::INFO_MINOR, "Script profiler reset");
+    }
+
+    if (!dumpPath.empty())
+    {
+        bool const success = DumpToJson(dumpPath);
+        g_theDevConsole->AddLine(success ? DevConsole::INFO_MINOR : DevConsole::ERROR,
+                                 Stringf("%s script profile to %s", success ? "Wrote" : "Failed to write", dumpPath.c_str()));
+    }
+
+    if (!enable.empty() || !dumpPath.empty() || reset)
+    {
+        return true;
+    }
+
+    g_theDevConsole->AddLine(DevConsole::INFO_MAJOR, Stringf("%-28s %10s %12s %10s %10s", "Name", "Calls", "Total(us)", "Max(us)", "Conv(us)"));
+
+    for (sScriptCallStats const& stats : GetStatsSortedByTotalTime())
+    {
+        if (stats.m_callCount == 0)
+        {
+            continue;
+        }
+
+        g_theDevConsole->AddLine(DevConsole::INFO_MINOR, Stringf("%-28s %10llu %12.1f %10.1f %10.1f",
+                                                                 stats.m_name.c_str(),
+                                                                 static_cast<unsigned long long>(stats.m_callCount),
+                                                                 static_cast<double>(stats.m_totalNs) / 1000.0,
+                                                                 static_cast<double>(stats.m_maxNs) / 1000.0,
+                                                                 static_cast<double>(stats.m_conversionNs) / 1000.0));
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC std::vector<sScriptCallStats>& ScriptCallProfiler::GetEntries()
+{
+    static std::vector<sScriptCallStats> s_entries;
+    return s_entries;
+}
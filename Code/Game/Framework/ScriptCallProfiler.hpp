@@ -0,0 +1,61 @@
+//----------------------------------------------------------------------------------------------------
+// ScriptCallProfiler.hpp
+// 腳本呼叫分析器 - 記錄每個綁定方法與全域函式的呼叫次數、耗時與參數轉型時間
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+#include "Engine/Core/EventSystem.hpp"
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+struct sScriptCallStats
+{
+    std::string m_name;
+    uint64_t    m_callCount    = 0;
+    uint64_t    m_totalNs      = 0;
+    uint64_t    m_maxNs        = 0;
+    uint64_t    m_conversionNs = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// 每個入口在註冊時取得固定的 slot，記錄時直接以索引存取，不做字串查找。
+// 停用時呼叫端只需檢查一次 IsEnabled()，不會讀取時間。
+// 只在主執行緒（V8 回呼所在的執行緒）使用。
+//
+// DevConsole 指令：
+//   ScriptProfile                  列出目前的統計（依總耗時排序）
+//   ScriptProfile enable=true      開始 / 停止（enable=false）記錄
+//   ScriptProfile reset=true       清除統計
+//   ScriptProfile dump=<path>      輸出 JSON，供不同版本之間離線比較
+//----------------------------------------------------------------------------------------------------
+class ScriptCallProfiler
+{
+public:
+    static uint32_t RegisterEntry(std::string const& name);
+
+    static bool IsEnabled() { return s_isEnabled; }
+    static void SetEnabled(bool isEnabled) { s_isEnabled = isEnabled; }
+
+    static uint64_t GetTimeNs();
+    static void     Record(uint32_t slot, uint64_t totalNs, uint64_t conversionNs);
+    static void     Reset();
+
+    static std::vector<sScriptCallStats> GetStatsSortedByTotalTime();
+    static bool                          DumpToJson(std::string const& filePath);
+
+    static bool OnScriptProfileCommand(EventArgs& args);
+
+private:
+    static std::vector<sScriptCallStats>& GetEntries();
+
+    static inline bool s_isEnabled = false;
+};
+
+//----------------------------------------------------------------------------------------------------
+inline uint64_t ScriptCallProfiler::GetTimeNs()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
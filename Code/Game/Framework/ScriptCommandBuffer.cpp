@@ -0,0 +1,136 @@
+//----------------------------------------------------------------------------------------------------
+// ScriptCommandBuffer.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/ScriptCommandBuffer.hpp"
+
+//----------------------------------------------------------------------------------------------------
+ScriptCommandBuffer::ScriptCommandBuffer(uint32_t const commandCapacity, uint32_t const payloadCubeCapacity)
+{
+    // 指令容量取 2 的次方，序號以遮罩取代取餘數
+    uint32_t powerOfTwo = 1;
+    while (powerOfTwo < commandCapacity)
+    {
+        powerOfTwo <<= 1;
+    }
+
+    m_commands.resize(powerOfTwo);
+    m_mask = powerOfTwo - 1;
+
+    m_payloadCapacity = std::max(payloadCubeCapacity, 1u);
+    m_positionPayload.resize(static_cast<size_t>(m_payloadCapacity) * 3);
+    m_colorPayload.resize(m_payloadCapacity);
+    m_handlePayload.resize(m_payloadCapacity);
+}
+
+//----------------------------------------------------------------------------------------------------
+// color 為空時套用時使用隨機顏色
+//----------------------------------------------------------------------------------------------------
+bool ScriptCommandBuffer::PushCreateCube(Vec3 const& position, sEntityHandle const reservedHandle, std::span<Rgba8 const> const color)
+{
+    float const xyz[3] = {position.x, position.y, position.z};
+    return PushCreateCubes(xyz, color, std::span<sEntityHandle const>(&reservedHandle, 1));
+}
+
+//----------------------------------------------------------------------------------------------------
+// 每個方塊都需要一個入列前保留的控制代碼（reservedHandles 與方塊一一對應）。
+// 指令環或 payload 放不下時整批捨棄，不寫入任何資料
+//----------------------------------------------------------------------------------------------------
+bool ScriptCommandBuffer::PushCreateCubes(std::span<float const> const positions, std::span<Rgba8 const> const colors, std::span<sEntityHandle const> const reservedHandles)
+{
+    uint32_t const numCubes = static_cast<uint32_t>(std::min(positions.size() / 3, reservedHandles.size()));
+    if (numCubes == 0)
+    {
+        return true;
+    }
+
+    if (GetCount() == GetCapacity())
+    {
+        return false;
+    }
+
+    sScriptCommand command;
+    command.m_type      = eScriptCommandType::CREATE_CUBES;
+    command.m_hasColors = colors.size() >= numCubes;   // 顏色不足時套用時以隨機顏色補上，因此只在數量足夠時才記錄
+    command.m_count     = numCubes;
+
+    if (!AllocatePayload(numCubes, command.m_payloadOffset))
+    {
+        return false;
+    }
+
+    std::copy_n(positions.begin(), static_cast<size_t>(numCubes) * 3, m_positionPayload.begin() + static_cast<ptrdiff_t>(command.m_payloadOffset) * 3);
+    std::copy_n(reservedHandles.begin(), numCubes, m_handlePayload.begin() + command.m_payloadOffset);
+
+    if (command.m_hasColors)
+    {
+        std::copy_n(colors.begin(), numCubes, m_colorPayload.begin() + command.m_payloadOffset);
+    }
+
+    m_pendingCreateCount += numCubes;
+
+    return Push(command);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool ScriptCommandBuffer::PushRemoveProp(sEntityHandle const handle)
+{
+    sScriptCommand command;
+    command.m_type   = eScriptCommandType::REMOVE_PROP;
+    command.m_handle = handle;
+
+    return Push(command);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool ScriptCommandBuffer::Push(sScriptCommand const& command)
+{
+    if (GetCount() == GetCapacity())
+    {
+        return false;
+    }
+
+    m_commands[m_tail & m_mask] = command;
+    ++m_tail;
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// 在 payload 中取得 cubeCount 個連續的方塊位置；已入列的指令全部套用後才回到開頭
+//----------------------------------------------------------------------------------------------------
+bool ScriptCommandBuffer::AllocatePayload(uint32_t const cubeCount, uint32_t& outOffset)
+{
+    if (m_payloadUsed == 0)
+    {
+        m_payloadTail = 0;
+    }
+
+    if (cubeCount > m_payloadCapacity - m_payloadTail)
+    {
+        return false;
+    }
+
+    outOffset      = m_payloadTail;
+    m_payloadTail += cubeCount;
+    m_payloadUsed += cubeCount;
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// 套用完一個指令後推進讀取端，釋放它佔用的 payload
+//----------------------------------------------------------------------------------------------------
+void ScriptCommandBuffer::ReleaseCommand(sScriptCommand const& command)
+{
+    ++m_head;
+
+    if (command.m_type != eScriptCommandType::CREATE_CUBES)
+    {
+        return;
+    }
+
+    m_payloadUsed        -= command.m_count;
+    m_pendingCreateCount -= command.m_count;
+}
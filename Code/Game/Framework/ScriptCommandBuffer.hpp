@@ -0,0 +1,114 @@
+//----------------------------------------------------------------------------------------------------
+// ScriptCommandBuffer.hpp
+// 腳本指令緩衝區 - JavaScript 對遊戲狀態的修改先記錄在這裡，由 Game::Update 每幀統一套用
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Math/Vec3.hpp"
+#include "Game/Framework/EntityHandle.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+// MOVE_PROP 只出現在工作執行緒送回的指令；移動不進入 ScriptCommandBuffer，
+// 而是寫入 SharedTransformBuffer 的位置欄位，與 writeTransforms 依寫入順序合併
+//----------------------------------------------------------------------------------------------------
+enum class eScriptCommandType : uint8_t
+{
+    CREATE_CUBES,
+    MOVE_PROP,
+    REMOVE_PROP
+};
+
+//----------------------------------------------------------------------------------------------------
+// 單一指令；CREATE_CUBES 的座標、顏色與預先保留的控制代碼存放在 payload 中，以 offset/count 參照。
+// m_handle：REMOVE_PROP 的目標
+//----------------------------------------------------------------------------------------------------
+struct sScriptCommand
+{
+    eScriptCommandType m_type          = eScriptCommandType::CREATE_CUBES;
+    bool               m_hasColors     = false;
+    sEntityHandle      m_handle;
+    uint32_t           m_payloadOffset = 0;
+    uint32_t           m_count         = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// 建構時配置完成、之後不再成長的環狀指令緩衝區。
+// 指令存放在環中，讀寫序號持續遞增；payload（每個方塊 PAYLOAD_BYTES_PER_CUBE 位元組）依序配置，
+// 隨指令套用釋放，全部套用完才回到開頭。任一個已滿時 Push 回傳 false，由呼叫端捨棄該指令並警告，
+// 不會在腳本執行中途套用。Consume 邊套用邊推進讀取端，Game::Update 開頭的 Consume 是唯一的套用點。
+//----------------------------------------------------------------------------------------------------
+class ScriptCommandBuffer
+{
+public:
+    static size_t constexpr PAYLOAD_BYTES_PER_CUBE = 3 * sizeof(float) + sizeof(Rgba8) + sizeof(sEntityHandle);
+
+    explicit ScriptCommandBuffer(uint32_t commandCapacity = 1u << 16, uint32_t payloadCubeCapacity = 1u << 17);
+
+    bool PushCreateCube(Vec3 const& position, sEntityHandle reservedHandle, std::span<Rgba8 const> color = {});
+    bool PushCreateCubes(std::span<float const> positions, std::span<Rgba8 const> colors, std::span<sEntityHandle const> reservedHandles);
+    bool PushRemoveProp(sEntityHandle handle);
+
+    bool     IsEmpty() const { return m_head == m_tail; }
+    uint32_t GetCount() const { return m_tail - m_head; }
+    uint32_t GetCapacity() const { return static_cast<uint32_t>(m_commands.size()); }
+    uint32_t GetPayloadCapacity() const { return m_payloadCapacity; }
+    uint32_t GetPayloadUsed() const { return m_payloadUsed; }
+    size_t   GetPendingCreateCount() const { return m_pendingCreateCount; }
+
+    // 依序套用並移除所有指令：onCreateCubes(std::span<float const> positions, std::span<Rgba8 const> colors, std::span<sEntityHandle const> reservedHandles)、
+    // onRemoveProp(sEntityHandle handle)
+    template <typename CreateCubesFunc, typename RemovePropFunc>
+    void Consume(CreateCubesFunc&& onCreateCubes, RemovePropFunc&& onRemoveProp);
+
+private:
+    bool Push(sScriptCommand const& command);
+    bool AllocatePayload(uint32_t cubeCount, uint32_t& outOffset);
+    void ReleaseCommand(sScriptCommand const& command);
+
+    std::vector<sScriptCommand> m_commands;
+    uint32_t                    m_mask               = 0;
+    uint32_t                    m_head               = 0;   // 讀取與寫入端的序號持續遞增，以 m_mask 取得槽位
+    uint32_t                    m_tail               = 0;
+    size_t                      m_pendingCreateCount = 0;
+
+    std::vector<float>          m_positionPayload;          // 以方塊為單位：m_payloadCapacity 個 (x, y, z)
+    std::vector<Rgba8>          m_colorPayload;
+    std::vector<sEntityHandle>  m_handlePayload;
+    uint32_t                    m_payloadCapacity = 0;
+    uint32_t                    m_payloadTail     = 0;      // 下一個寫入位置
+    uint32_t                    m_payloadUsed     = 0;      // 尚未套用的方塊數
+};
+
+//----------------------------------------------------------------------------------------------------
+template <typename CreateCubesFunc, typename RemovePropFunc>
+void ScriptCommandBuffer::Consume(CreateCubesFunc&& onCreateCubes, RemovePropFunc&& onRemoveProp)
+{
+    while (m_head != m_tail)
+    {
+        sScriptCommand const command = m_commands[m_head & m_mask];
+
+        if (command.m_type == eScriptCommandType::CREATE_CUBES)
+        {
+            std::span<float const> const positions(&m_positionPayload[static_cast<size_t>(command.m_payloadOffset) * 3], static_cast<size_t>(command.m_count) * 3);
+            std::span<Rgba8 const>       colors;
+
+            if (command.m_hasColors)
+            {
+                colors = std::span<Rgba8 const>(&m_colorPayload[command.m_payloadOffset], command.m_count);
+            }
+
+            onCreateCubes(positions, colors, std::span<sEntityHandle const>(&m_handlePayload[command.m_payloadOffset], command.m_count));
+        }
+        else if (command.m_type == eScriptCommandType::REMOVE_PROP)
+        {
+            onRemoveProp(command.m_handle);
+        }
+
+        ReleaseCommand(command);
+    }
+}
@@ -0,0 +1,58 @@
+//----------------------------------------------------------------------------------------------------
+// ScriptLibrary.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/ScriptLibrary.hpp"
+
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/Time.hpp"
+#include "Engine/Scripting/V8Subsystem.hpp"
+
+//----------------------------------------------------------------------------------------------------
+ScriptLibrary::ScriptLibrary(sScriptLibraryConfig config)
+    : m_config(std::move(config))
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+// 函式庫只需執行一次；重複呼叫直接回傳先前的結果
+//----------------------------------------------------------------------------------------------------
+bool ScriptLibrary::Load()
+{
+    if (m_isLoaded)
+    {
+        return true;
+    }
+
+    if (!g_theV8Subsystem || !g_theV8Subsystem->IsInitialized())
+    {
+        DebuggerPrintf("警告：V8Subsystem 不可用，無法載入腳本函式庫\n");
+        return false;
+    }
+
+    double const startSeconds = GetCurrentTimeSeconds();
+    bool         allSucceeded = true;
+
+    for (std::string const& scriptPath : m_config.m_scriptPaths)
+    {
+        if (!g_theV8Subsystem->ExecuteScriptFile(scriptPath))
+        {
+            DebuggerPrintf("腳本函式庫載入失敗: %s\n", scriptPath.c_str());
+
+            if (g_theV8Subsystem->HasError())
+            {
+                DebuggerPrintf("錯誤: %s\n", g_theV8Subsystem->GetLastError().c_str());
+            }
+
+            allSucceeded = false;
+        }
+    }
+
+    m_loadSeconds = GetCurrentTimeSeconds() - startSeconds;
+    m_isLoaded    = allSucceeded;
+
+    DebuggerPrintf("腳本函式庫載入完成：%zu 個檔案，耗時 %.2f ms\n", m_config.m_scriptPaths.size(), m_loadSeconds * 1000.0);
+
+    return allSucceeded;
+}
@@ -0,0 +1,36 @@
+//----------------------------------------------------------------------------------------------------
+// ScriptLibrary.hpp
+// 標準腳本函式庫 - 綁定完成後於啟動時執行一次，之後的遊戲腳本可直接使用
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+// 依序執行的函式庫腳本；每次啟動都會重新編譯執行（沒有啟動快照），耗時記錄在 GetLoadSeconds。
+// 函式庫只應放定義，不要在載入時做大量運算，以免拖慢啟動。
+//----------------------------------------------------------------------------------------------------
+struct sScriptLibraryConfig
+{
+    std::vector<std::string> m_scriptPaths = {"Data/Scripts/Library/Prelude.js",
+                                              "Data/Scripts/Library/Scheduler.js"};
+};
+
+//----------------------------------------------------------------------------------------------------
+class ScriptLibrary
+{
+public:
+    explicit ScriptLibrary(sScriptLibraryConfig config = {});
+
+    bool Load();
+
+    bool                            IsLoaded() const { return m_isLoaded; }
+    double                          GetLoadSeconds() const { return m_loadSeconds; }
+    std::vector<std::string> const& GetScriptPaths() const { return m_config.m_scriptPaths; }
+
+private:
+    sScriptLibraryConfig m_config;
+    bool                 m_isLoaded    = false;
+    double               m_loadSeconds = 0.0;
+};
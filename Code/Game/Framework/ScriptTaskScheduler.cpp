@@ -0,0 +1,74 @@
+//----------------------------------------------------------------------------------------------------
+// ScriptTaskScheduler.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/ScriptTaskScheduler.hpp"
+
+#include "Engine/Core/Clock.hpp"
+#include "Engine/Core/DevConsole.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Engine/Core/Time.hpp"
+#include "Engine/Scripting/V8Subsystem.hpp"
+#include "Game/Framework/FrameProfiler.hpp"
+
+//----------------------------------------------------------------------------------------------------
+ScriptTaskScheduler::ScriptTaskScheduler(sScriptTaskSchedulerConfig const& config)
+    : m_config(config)
+{
+    SetFrameBudgetMs(m_config.m_frameBudgetMs);
+}
+
+//----------------------------------------------------------------------------------------------------
+void ScriptTaskScheduler::SetFrameBudgetMs(double const frameBudgetMs)
+{
+    m_config.m_frameBudgetMs = frameBudgetMs;
+    m_tickCommand            = Stringf("Scheduler.tick(%.3f);", frameBudgetMs);
+}
+
+//----------------------------------------------------------------------------------------------------
+void ScriptTaskScheduler::Tick(Clock const& gameClock)
+{
+    PROFILE_SCOPE("ScriptTaskScheduler::Tick");
+
+    m_lastTickMs = 0.0;
+
+    if (m_isPaused || m_pendingTaskCount <= 0 || gameClock.IsPaused() || !g_theV8Subsystem || !g_theV8Subsystem->IsInitialized())
+    {
+        return;
+    }
+
+    double const startSeconds = GetCurrentTimeSeconds();
+    bool const   success      = g_theV8Subsystem->ExecuteScript(m_tickCommand);
+    m_lastTickMs              = (GetCurrentTimeSeconds() - startSeconds) * 1000.0;
+
+    if (success)
+    {
+        m_hasReportedError = false;
+        return;
+    }
+
+    if (!m_hasReportedError)
+    {
+        m_hasReportedError = true;
+        DebuggerPrintf("Scheduler.tick 執行失敗（恢復前不再重複顯示）: %s\n", g_theV8Subsystem->GetLastError().c_str());
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Scheduler.js 對每個任務只回報一次
+//----------------------------------------------------------------------------------------------------
+void ScriptTaskScheduler::ReportOverBudget(std::string const& taskName, float const stepMs) const
+{
+    if (!g_theDevConsole)
+    {
+        return;
+    }
+
+    g_theDevConsole->AddLine(DevConsole::WARNING,
+                             Stringf("Script task '%s' step took %.2f ms (budget %.2f ms)",
+                                     taskName.c_str(),
+                                     stepMs,
+                                     m_config.m_frameBudgetMs));
+}
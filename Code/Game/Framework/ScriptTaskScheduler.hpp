@@ -0,0 +1,51 @@
+//----------------------------------------------------------------------------------------------------
+// ScriptTaskScheduler.hpp
+// 腳本任務排程器 - 每幀以固定的毫秒預算推進 Data/Scripts/Library/Scheduler.js 中的任務
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+#include <string>
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class Clock;
+
+//----------------------------------------------------------------------------------------------------
+struct sScriptTaskSchedulerConfig
+{
+    double m_frameBudgetMs = 4.0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// 優先權與防飢餓（aging）由 JS 端的 Scheduler.tick 處理；C++ 端負責：
+//  - 遊戲時鐘暫停或被暫停（閒置節流）時不推進任務
+//  - 沒有待執行的任務時完全不進入 V8（任務數由 Scheduler.js 透過 game.setScriptTaskCount 回報）
+//  - 量測整次 tick 的實際耗時
+//  - 把單一步驟就超過預算的任務（由 game.reportScriptTaskOverBudget 回報）顯示在 DevConsole
+// tick 指令只在預算改變時重新產生，每幀送出相同的原始碼，V8 的編譯快取不會重新編譯。
+// 只支援 generator 任務；async 函式與 Promise 由 V8 的 microtask 佇列執行，不受每幀預算控制。
+//----------------------------------------------------------------------------------------------------
+class ScriptTaskScheduler
+{
+public:
+    explicit ScriptTaskScheduler(sScriptTaskSchedulerConfig const& config = {});
+
+    void Tick(Clock const& gameClock);
+
+    void ReportOverBudget(std::string const& taskName, float stepMs) const;
+
+    void   SetFrameBudgetMs(double frameBudgetMs);
+    double GetFrameBudgetMs() const { return m_config.m_frameBudgetMs; }
+    double GetLastTickMs() const { return m_lastTickMs; }
+    void   SetPaused(bool isPaused) { m_isPaused = isPaused; }
+    bool   IsPaused() const { return m_isPaused; }
+    void   SetPendingTaskCount(int taskCount) { m_pendingTaskCount = taskCount; }
+    int    GetPendingTaskCount() const { return m_pendingTaskCount; }
+
+private:
+    sScriptTaskSchedulerConfig m_config;
+    std::string                m_tickCommand;
+    double                     m_lastTickMs       = 0.0;
+    int                        m_pendingTaskCount = 0;
+    bool                       m_isPaused         = false;
+    bool                       m_hasReportedError = false;   // 連續失敗只印一次，成功後重設
+};
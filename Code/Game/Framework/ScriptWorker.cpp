@@ -0,0 +1,143 @@
+//----------------------------------------------------------------------------------------------------
+// ScriptWorker.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/ScriptWorker.hpp"
+
+#include "Game/Framework/FrameProfiler.hpp"
+
+//----------------------------------------------------------------------------------------------------
+ScriptWorker::ScriptWorker(sScriptWorkerConfig const& config, ScriptWorkerExecutor executor)
+    : m_executor(std::move(executor)),
+      m_inbox(config.m_inboxCapacity),
+      m_outbox(config.m_outboxCapacity),
+      m_reservedHandles(config.m_reservedHandleCapacity)
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+ScriptWorker::~ScriptWorker()
+{
+    Stop();
+}
+
+//----------------------------------------------------------------------------------------------------
+void ScriptWorker::Start()
+{
+    if (m_isRunning.exchange(true))
+    {
+        return;
+    }
+
+    m_thread = std::thread(&ScriptWorker::ThreadMain, this);
+}
+
+//----------------------------------------------------------------------------------------------------
+// 尚未執行的腳本直接捨棄；已送出的指令留在 outbox，仍可由主執行緒 DrainCommands 取回
+//----------------------------------------------------------------------------------------------------
+void ScriptWorker::Stop()
+{
+    if (!m_isRunning.exchange(false))
+    {
+        return;
+    }
+
+    m_wakeSignal.fetch_add(1, std::memory_order_release);
+    m_wakeSignal.notify_one();
+
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+bool ScriptWorker::SubmitScript(std::string script)
+{
+    if (!m_inbox.TryPush(std::move(script)))
+    {
+        return false;
+    }
+
+    m_wakeSignal.fetch_add(1, std::memory_order_release);
+    m_wakeSignal.notify_one();
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// 不喚醒工作執行緒，也不佔用 inbox；工作執行緒下次讀取時拿到最新的一份
+//----------------------------------------------------------------------------------------------------
+void ScriptWorker::PublishSnapshot(sScriptStateSnapshot const& snapshot)
+{
+    m_snapshotSlots[m_publishSnapshotSlot] = snapshot;
+
+    uint32_t const previousSlot = m_sharedSnapshotSlot.exchange(m_publishSnapshotSlot | SNAPSHOT_FRESH_BIT, std::memory_order_acq_rel);
+    m_publishSnapshotSlot       = previousSlot & SNAPSHOT_INDEX_MASK;
+}
+
+//----------------------------------------------------------------------------------------------------
+sScriptStateSnapshot ScriptWorker::GetLatestSnapshot()
+{
+    if (m_sharedSnapshotSlot.load(std::memory_order_relaxed) & SNAPSHOT_FRESH_BIT)
+    {
+        uint32_t const previousSlot = m_sharedSnapshotSlot.exchange(m_readSnapshotSlot, std::memory_order_acq_rel);
+        m_readSnapshotSlot          = previousSlot & SNAPSHOT_INDEX_MASK;
+    }
+
+    return m_snapshotSlots[m_readSnapshotSlot];
+}
+
+//----------------------------------------------------------------------------------------------------
+// 保留的控制代碼用完時回傳無效的控制代碼，主執行緒下一幀 ReserveHandles 後才會補充
+//----------------------------------------------------------------------------------------------------
+sEntityHandle ScriptWorker::TakeReservedHandle()
+{
+    sEntityHandle handle;
+    m_reservedHandles.TryPop(handle);
+    return handle;
+}
+
+//----------------------------------------------------------------------------------------------------
+// outbox 滿時等待主執行緒取走指令（背壓），而不是丟棄遊戲狀態的修改
+//----------------------------------------------------------------------------------------------------
+bool ScriptWorker::PushCommand(sScriptWorkerCommand const& command)
+{
+    while (!m_outbox.TryPush(command))
+    {
+        if (!IsRunning())
+        {
+            return false;
+        }
+
+        std::this_thread::yield();
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void ScriptWorker::ThreadMain()
+{
+    FrameProfiler::SetThreadName("ScriptWorker");
+
+    std::string script;
+
+    while (IsRunning())
+    {
+        uint32_t const observedSignal = m_wakeSignal.load(std::memory_order_acquire);
+
+        while (IsRunning() && m_inbox.TryPop(script))
+        {
+            if (m_executor)
+            {
+                PROFILE_SCOPE("ScriptWorker::Execute");
+                m_executor(*this, script);
+            }
+        }
+
+        // 沒有新訊息時休眠，直到 SubmitScript 或 Stop 改變 m_wakeSignal
+        m_wakeSignal.wait(observedSignal, std::memory_order_acquire);
+    }
+}
@@ -0,0 +1,160 @@
+//----------------------------------------------------------------------------------------------------
+// ScriptWorker.hpp
+// 腳本工作執行緒 - 在獨立執行緒上執行遊戲腳本，只透過訊息佇列與主執行緒溝通
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Math/Vec3.hpp"
+#include "Game/Framework/ScriptCommandBuffer.hpp"
+#include "Game/Framework/SpscQueue.hpp"
+#include <atomic>
+#include <functional>
+#include <string>
+#include <thread>
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class ScriptWorker;
+
+//----------------------------------------------------------------------------------------------------
+// 主執行緒每幀送出的唯讀遊戲狀態；不經過 inbox，工作執行緒永遠只看到最新的一份
+//----------------------------------------------------------------------------------------------------
+struct sScriptStateSnapshot
+{
+    uint64_t m_frameIndex     = 0;
+    double   m_gameSeconds    = 0.0;
+    Vec3     m_playerPosition = Vec3::ZERO;
+    uint32_t m_propCount      = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// 工作執行緒送回主執行緒的指令；主執行緒再轉入 Game 的 ScriptCommandBuffer。
+// CREATE_CUBES 的 m_handle 若是 TakeReservedHandle 取得的控制代碼，方塊建立後沿用它（與 Game::CreateCube 相同）
+//----------------------------------------------------------------------------------------------------
+struct sScriptWorkerCommand
+{
+    eScriptCommandType m_type     = eScriptCommandType::CREATE_CUBES;
+    bool               m_hasColor = false;
+    sEntityHandle      m_handle;
+    Vec3               m_position = Vec3::ZERO;
+    Rgba8              m_color    = Rgba8::WHITE;
+};
+
+//----------------------------------------------------------------------------------------------------
+// 在工作執行緒上執行一段腳本。實作端持有工作執行緒專用的 isolate，
+// 透過 worker.GetLatestSnapshot() 讀取遊戲狀態，以 worker.PushCommand() 送出修改；
+// createCube 應先以 worker.TakeReservedHandle() 取得控制代碼並立即回傳給腳本。
+//----------------------------------------------------------------------------------------------------
+using ScriptWorkerExecutor = std::function<void(ScriptWorker& worker, std::string const& script)>;
+
+//----------------------------------------------------------------------------------------------------
+struct sScriptWorkerConfig
+{
+    uint32_t m_inboxCapacity          = 256;
+    uint32_t m_outboxCapacity         = 4096;
+    uint32_t m_reservedHandleCapacity = 256;   // 主執行緒預先保留、交給工作執行緒使用的控制代碼數
+};
+
+//----------------------------------------------------------------------------------------------------
+class ScriptWorker
+{
+public:
+    ScriptWorker(sScriptWorkerConfig const& config, ScriptWorkerExecutor executor);
+    ~ScriptWorker();
+
+    void Start();
+    void Stop();
+    bool IsRunning() const { return m_isRunning.load(std::memory_order_acquire); }
+
+    // 主執行緒
+    bool SubmitScript(std::string script);
+    void PublishSnapshot(sScriptStateSnapshot const& snapshot);
+    template <typename CommandFunc>
+    size_t DrainCommands(CommandFunc&& onCommand);
+    template <typename AllocateFunc>
+    size_t ReserveHandles(AllocateFunc&& allocateHandle);
+    template <typename ReleaseFunc>
+    size_t ReleaseReservedHandles(ReleaseFunc&& releaseHandle);
+
+    // 工作執行緒（由 executor 呼叫）
+    bool                 PushCommand(sScriptWorkerCommand const& command);
+    sEntityHandle        TakeReservedHandle();
+    sScriptStateSnapshot GetLatestSnapshot();
+
+private:
+    void ThreadMain();
+
+    // 快照以三個 slot 輪替：主執行緒寫入自己的 slot 後與共用 slot 交換，工作執行緒讀取前若有新資料再交換一次，
+    // 雙方永遠不會同時存取同一個 slot。共用 slot 的索引附帶 SNAPSHOT_FRESH_BIT 表示尚未被讀取
+    static uint32_t constexpr SNAPSHOT_INDEX_MASK = 0x3;
+    static uint32_t constexpr SNAPSHOT_FRESH_BIT  = 0x4;
+
+    ScriptWorkerExecutor            m_executor;
+    SpscQueue<std::string>          m_inbox;
+    SpscQueue<sScriptWorkerCommand> m_outbox;
+    SpscQueue<sEntityHandle>        m_reservedHandles;              // 主執行緒生產、工作執行緒消費
+    sScriptStateSnapshot            m_snapshotSlots[3];
+    std::atomic<uint32_t>           m_sharedSnapshotSlot{1};
+    uint32_t                        m_publishSnapshotSlot = 0;      // 只由主執行緒存取
+    uint32_t                        m_readSnapshotSlot    = 2;      // 只由工作執行緒存取
+    std::atomic<uint32_t>           m_wakeSignal{0};
+    std::atomic<bool>               m_isRunning{false};
+    std::thread                     m_thread;
+};
+
+//----------------------------------------------------------------------------------------------------
+template <typename CommandFunc>
+size_t ScriptWorker::DrainCommands(CommandFunc&& onCommand)
+{
+    size_t               numCommands = 0;
+    sScriptWorkerCommand command;
+
+    while (m_outbox.TryPop(command))
+    {
+        onCommand(command);
+        ++numCommands;
+    }
+
+    return numCommands;
+}
+
+//----------------------------------------------------------------------------------------------------
+// 補滿保留的控制代碼；allocateHandle() 回傳無效的控制代碼（例如數量已達上限）時停止
+//----------------------------------------------------------------------------------------------------
+template <typename AllocateFunc>
+size_t ScriptWorker::ReserveHandles(AllocateFunc&& allocateHandle)
+{
+    size_t numReserved = 0;
+
+    while (!m_reservedHandles.IsFull())
+    {
+        sEntityHandle const handle = allocateHandle();
+        if (!handle.IsValid())
+        {
+            break;
+        }
+
+        m_reservedHandles.TryPush(handle);
+        ++numReserved;
+    }
+
+    return numReserved;
+}
+
+//----------------------------------------------------------------------------------------------------
+// 只能在 Stop 之後呼叫（此時主執行緒是唯一的消費者），歸還工作執行緒沒有用到的控制代碼
+//----------------------------------------------------------------------------------------------------
+template <typename ReleaseFunc>
+size_t ScriptWorker::ReleaseReservedHandles(ReleaseFunc&& releaseHandle)
+{
+    size_t        numReleased = 0;
+    sEntityHandle handle;
+
+    while (m_reservedHandles.TryPop(handle))
+    {
+        releaseHandle(handle);
+        ++numReleased;
+    }
+
+    return numReleased;
+}
@@ -0,0 +1,111 @@
+//----------------------------------------------------------------------------------------------------
+// SharedTransformBuffer.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/SharedTransformBuffer.hpp"
+
+#include "Engine/Core/EngineCommon.hpp"
+#include <cstring>
+
+//----------------------------------------------------------------------------------------------------
+SharedTransformBuffer::SharedTransformBuffer(uint32_t const slotCapacity)
+    : m_floats(static_cast<size_t>(slotCapacity) * FLOATS_PER_SLOT, 0.f),
+      m_slotCapacity(slotCapacity),
+      m_slotFieldMasks(slotCapacity, 0)
+{
+    // 每個 slot 最多出現一次，預先保留後標記時不會配置記憶體
+    m_dirtySlots.reserve(slotCapacity);
+}
+
+//----------------------------------------------------------------------------------------------------
+// floats 每 floatsPerSlot 個數值寫入一個 slot 的 [fieldOffset, fieldOffset + floatsPerSlot) 欄位；
+// 長度不是 floatsPerSlot 的倍數或超出容量時不寫入任何資料
+//----------------------------------------------------------------------------------------------------
+bool SharedTransformBuffer::Write(uint32_t const firstSlot, std::span<float const> const floats, uint32_t const fieldOffset, uint32_t const floatsPerSlot)
+{
+    if (floatsPerSlot == 0 || fieldOffset + floatsPerSlot > FLOATS_PER_SLOT || floats.size() % floatsPerSlot != 0)
+    {
+        return false;
+    }
+
+    uint32_t const slotCount = static_cast<uint32_t>(floats.size() / floatsPerSlot);
+
+    if (slotCount == 0 || firstSlot >= m_slotCapacity || slotCount > m_slotCapacity - firstSlot)
+    {
+        return false;
+    }
+
+    if (floatsPerSlot == FLOATS_PER_SLOT)
+    {
+        std::memcpy(&m_floats[static_cast<size_t>(firstSlot) * FLOATS_PER_SLOT], floats.data(), floats.size_bytes());
+    }
+    else
+    {
+        for (uint32_t slotIndex = 0; slotIndex < slotCount; ++slotIndex)
+        {
+            float* destination = &m_floats[static_cast<size_t>(firstSlot + slotIndex) * FLOATS_PER_SLOT + fieldOffset];
+            std::memcpy(destination, &floats[static_cast<size_t>(slotIndex) * floatsPerSlot], floatsPerSlot * sizeof(float));
+        }
+    }
+
+    return MarkDirty(firstSlot, slotCount, GetFieldMask(fieldOffset, floatsPerSlot));
+}
+
+//----------------------------------------------------------------------------------------------------
+bool SharedTransformBuffer::MarkDirty(uint32_t const firstSlot, uint32_t const slotCount, uint8_t const fieldMask)
+{
+    if (slotCount == 0 || firstSlot >= m_slotCapacity || slotCount > m_slotCapacity - firstSlot || (fieldMask & FIELD_ALL) == 0)
+    {
+        return false;
+    }
+
+    for (uint32_t slot = firstSlot; slot < firstSlot + slotCount; ++slot)
+    {
+        if (m_slotFieldMasks[slot] == 0)
+        {
+            m_dirtySlots.push_back(slot);
+        }
+
+        m_slotFieldMasks[slot] |= fieldMask & FIELD_ALL;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// [fieldOffset, fieldOffset + floatCount) 涵蓋到的欄位；只寫入欄位的一部分（例如只寫 x）也算寫入整個欄位
+//----------------------------------------------------------------------------------------------------
+STATIC uint8_t SharedTransformBuffer::GetFieldMask(uint32_t const fieldOffset, uint32_t const floatCount)
+{
+    uint32_t const fieldEnd  = fieldOffset + floatCount;
+    uint8_t        fieldMask = 0;
+
+    if (fieldOffset < ORIENTATION_OFFSET && fieldEnd > POSITION_OFFSET) fieldMask |= FIELD_POSITION;
+    if (fieldOffset < COLOR_OFFSET && fieldEnd > ORIENTATION_OFFSET) fieldMask |= FIELD_ORIENTATION;
+    if (fieldOffset < FLOATS_PER_SLOT && fieldEnd > COLOR_OFFSET) fieldMask |= FIELD_COLOR;
+
+    return fieldMask;
+}
+
+//----------------------------------------------------------------------------------------------------
+void SharedTransformBuffer::SetSlot(uint32_t const slot, Vec3 const& position, EulerAngles const& orientation, Rgba8 const& color)
+{
+    if (slot >= m_slotCapacity)
+    {
+        return;
+    }
+
+    float* values = &m_floats[static_cast<size_t>(slot) * FLOATS_PER_SLOT];
+
+    values[0] = position.x;
+    values[1] = position.y;
+    values[2] = position.z;
+    values[3] = orientation.m_yawDegrees;
+    values[4] = orientation.m_pitchDegrees;
+    values[5] = orientation.m_rollDegrees;
+    values[6] = static_cast<float>(color.r);
+    values[7] = static_cast<float>(color.g);
+    values[8] = static_cast<float>(color.b);
+    values[9] = static_cast<float>(color.a);
+}
@@ -0,0 +1,133 @@
+//----------------------------------------------------------------------------------------------------
+// SharedTransformBuffer.hpp
+// 腳本與遊戲共用的道具變換緩衝區 - 連續的 float 陣列，以 dirty range 通知遊戲哪些 slot 被腳本修改
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Math/EulerAngles.hpp"
+#include "Engine/Math/Vec3.hpp"
+#include "Game/Framework/EntityHandle.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+// 每個 slot（= 道具控制代碼的 slot 索引，handle & 0xFFFFF）佔 FLOATS_PER_SLOT 個 float：
+//   [0..2] position x, y, z            （FIELD_POSITION）
+//   [3..5] orientation yaw, pitch, roll（FIELD_ORIENTATION，角度）
+//   [6..9] color r, g, b, a（0 - 255） （FIELD_COLOR）
+//
+// 容量在建構時固定（預設涵蓋控制代碼的所有 slot），底層記憶體位址在整個生命週期內不變，
+// 可直接包裝成 ArrayBuffer 交給腳本（Float32Array 視圖）。
+//
+// 協定：
+//  - 遊戲每幀更新後以 SetSlot 寫回目前狀態，腳本讀到的永遠是最新值
+//  - 腳本寫入後以 Write（批次複製，可只寫部分欄位，例如只寫位置）或 MarkDirty（直接寫入記憶體時）標記 slot 與欄位
+//  - 每個 slot 記錄被寫入的欄位遮罩，套用時只更新寫過的欄位；同一幀多次寫入同一個 slot，最後寫入的值生效
+//----------------------------------------------------------------------------------------------------
+class SharedTransformBuffer
+{
+public:
+    static uint32_t constexpr FLOATS_PER_SLOT    = 10;
+    static uint32_t constexpr POSITION_OFFSET    = 0;
+    static uint32_t constexpr POSITION_FLOATS    = 3;
+    static uint32_t constexpr ORIENTATION_OFFSET = 3;
+    static uint32_t constexpr COLOR_OFFSET       = 6;
+
+    static uint8_t constexpr FIELD_POSITION    = 1 << 0;
+    static uint8_t constexpr FIELD_ORIENTATION = 1 << 1;
+    static uint8_t constexpr FIELD_COLOR       = 1 << 2;
+    static uint8_t constexpr FIELD_ALL         = FIELD_POSITION | FIELD_ORIENTATION | FIELD_COLOR;
+
+    explicit SharedTransformBuffer(uint32_t slotCapacity = sEntityHandle::MAX_SLOT_COUNT);
+
+    bool Write(uint32_t firstSlot, std::span<float const> floats, uint32_t fieldOffset = 0, uint32_t floatsPerSlot = FLOATS_PER_SLOT);
+    bool MarkDirty(uint32_t firstSlot, uint32_t slotCount, uint8_t fieldMask = FIELD_ALL);
+    void SetSlot(uint32_t slot, Vec3 const& position, EulerAngles const& orientation, Rgba8 const& color);
+
+    // bool onSlot(uint32_t slot, uint8_t fieldMask, Vec3 const& position, EulerAngles const& orientation, Rgba8 const& color)
+    // 依 slot 順序呼叫；回傳 false 的 slot 保持 dirty（欄位遮罩不變），留給下一次 ConsumeDirtySlots
+    template <typename SlotFunc>
+    void ConsumeDirtySlots(SlotFunc&& onSlot);
+
+    std::span<float> GetFloats() { return m_floats; }
+    uint32_t         GetSlotCapacity() const { return m_slotCapacity; }
+    bool             HasDirtySlots() const { return !m_dirtySlots.empty(); }
+
+    static uint8_t GetFieldMask(uint32_t fieldOffset, uint32_t floatCount);
+    static uint8_t ToColorByte(float value);
+
+private:
+    std::vector<float>    m_floats;
+    uint32_t              m_slotCapacity = 0;
+    std::vector<uint8_t>  m_slotFieldMasks;   // 每個 slot 被寫入的欄位，0 表示未修改
+    std::vector<uint32_t> m_dirtySlots;       // m_slotFieldMasks 非 0 的 slot，依標記順序
+};
+
+//----------------------------------------------------------------------------------------------------
+template <typename SlotFunc>
+void SharedTransformBuffer::ConsumeDirtySlots(SlotFunc&& onSlot)
+{
+    if (m_dirtySlots.empty())
+    {
+        return;
+    }
+
+    // 依 slot 排序讓道具的存取順序連續；dirty 的 slot 很多時直接掃描遮罩陣列比排序快
+    if (m_dirtySlots.size() > m_slotCapacity / 8)
+    {
+        m_dirtySlots.clear();
+
+        for (uint32_t slot = 0; slot < m_slotCapacity; ++slot)
+        {
+            if (m_slotFieldMasks[slot] != 0)
+            {
+                m_dirtySlots.push_back(slot);
+            }
+        }
+    }
+    else
+    {
+        std::sort(m_dirtySlots.begin(), m_dirtySlots.end());
+    }
+
+    size_t numRetained = 0;
+
+    for (uint32_t const slot : m_dirtySlots)
+    {
+        float const* values = &m_floats[static_cast<size_t>(slot) * FLOATS_PER_SLOT];
+
+        bool const isConsumed = onSlot(slot,
+                                       m_slotFieldMasks[slot],
+                                       Vec3(values[0], values[1], values[2]),
+                                       EulerAngles(values[3], values[4], values[5]),
+                                       Rgba8(ToColorByte(values[6]), ToColorByte(values[7]), ToColorByte(values[8]), ToColorByte(values[9])));
+
+        if (isConsumed)
+        {
+            m_slotFieldMasks[slot] = 0;
+        }
+        else
+        {
+            m_dirtySlots[numRetained++] = slot;
+        }
+    }
+
+    m_dirtySlots.resize(numRetained);
+}
+
+//----------------------------------------------------------------------------------------------------
+// 腳本寫入的顏色可能是任意 float；NaN 與無限大視為 0，其餘夾在 0 - 255（NaN 直接轉型為未定義行為）
+//----------------------------------------------------------------------------------------------------
+inline uint8_t SharedTransformBuffer::ToColorByte(float const value)
+{
+    if (!std::isfinite(value))
+    {
+        return 0;
+    }
+
+    return static_cast<uint8_t>(std::clamp(value, 0.f, 255.f));
+}
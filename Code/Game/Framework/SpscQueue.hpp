@@ -0,0 +1,122 @@
+//----------------------------------------------------------------------------------------------------
+// SpscQueue.hpp
+// 無鎖單一生產者 / 單一消費者佇列 - 主執行緒與腳本工作執行緒之間傳遞訊息
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+// 固定容量（2 的次方）的環狀佇列。
+// TryPush 只能由生產者執行緒呼叫，TryPop 只能由消費者執行緒呼叫；佇列滿或空時立即回傳 false。
+// 生產者與消費者各自快取對方的索引，只有在快取值不夠用時才讀取對方的 atomic。
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+class SpscQueue
+{
+public:
+    explicit SpscQueue(uint32_t capacity);
+
+    SpscQueue(SpscQueue const&)            = delete;
+    SpscQueue& operator=(SpscQueue const&) = delete;
+
+    bool TryPush(T const& item);
+    bool TryPush(T&& item);
+    bool TryPop(T& outItem);
+
+    bool     IsEmpty() const { return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire); }
+    bool     IsFull() const { return m_tail.load(std::memory_order_relaxed) - m_head.load(std::memory_order_acquire) == m_slots.size(); } // 只由生產者呼叫
+    uint32_t GetCapacity() const { return static_cast<uint32_t>(m_slots.size()); }
+
+private:
+    template <typename U>
+    bool Emplace(U&& item);
+
+    static size_t constexpr CACHE_LINE_SIZE = 64;
+
+    std::vector<T> m_slots;
+    size_t         m_mask = 0;
+
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_head{0}; // 消費者寫入
+    size_t m_cachedTail = 0;                                // 消費者看到的 m_tail
+
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_tail{0}; // 生產者寫入
+    size_t m_cachedHead = 0;                                // 生產者看到的 m_head
+};
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+SpscQueue<T>::SpscQueue(uint32_t const capacity)
+{
+    size_t powerOfTwo = 1;
+    while (powerOfTwo < capacity)
+    {
+        powerOfTwo <<= 1;
+    }
+
+    m_slots.resize(powerOfTwo);
+    m_mask = powerOfTwo - 1;
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+bool SpscQueue<T>::TryPush(T const& item)
+{
+    return Emplace(item);
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+bool SpscQueue<T>::TryPush(T&& item)
+{
+    return Emplace(std::move(item));
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+template <typename U>
+bool SpscQueue<T>::Emplace(U&& item)
+{
+    size_t const tail = m_tail.load(std::memory_order_relaxed);
+
+    if (tail - m_cachedHead == m_slots.size())
+    {
+        m_cachedHead = m_head.load(std::memory_order_acquire);
+
+        if (tail - m_cachedHead == m_slots.size())
+        {
+            return false;
+        }
+    }
+
+    m_slots[tail & m_mask] = std::forward<U>(item);
+    m_tail.store(tail + 1, std::memory_order_release);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+bool SpscQueue<T>::TryPop(T& outItem)
+{
+    size_t const head = m_head.load(std::memory_order_relaxed);
+
+    if (head == m_cachedTail)
+    {
+        m_cachedTail = m_tail.load(std::memory_order_acquire);
+
+        if (head == m_cachedTail)
+        {
+            return false;
+        }
+    }
+
+    outItem = std::move(m_slots[head & m_mask]);
+    m_head.store(head + 1, std::memory_order_release);
+
+    return true;
+}
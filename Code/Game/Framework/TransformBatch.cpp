@@ -0,0 +1,111 @@
+//----------------------------------------------------------------------------------------------------
+// TransformBatch.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/TransformBatch.hpp"
+
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Math/Vec3.hpp"
+#include <emmintrin.h>
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    // Cephes sinf/cosf：以 π/2 分成象限（Cody-Waite 三段常數減去，保留精度），在 [-π/4, π/4] 內以多項式近似，
+    // 再依象限交換 sin/cos 並調整正負號
+    //------------------------------------------------------------------------------------------------
+    void SinCos4(__m128 const radians, __m128& outSin, __m128& outCos)
+    {
+        __m128i const quadrant = _mm_cvtps_epi32(_mm_mul_ps(radians, _mm_set1_ps(0.63661977236758134f)));   // 2/π，四捨五入
+        __m128 const  q        = _mm_cvtepi32_ps(quadrant);
+
+        __m128 r = _mm_sub_ps(radians, _mm_mul_ps(q, _mm_set1_ps(1.5703125f)));
+        r        = _mm_sub_ps(r, _mm_mul_ps(q, _mm_set1_ps(4.837512969970703125e-4f)));
+        r        = _mm_sub_ps(r, _mm_mul_ps(q, _mm_set1_ps(7.54978995489188216e-8f)));
+
+        __m128 const z = _mm_mul_ps(r, r);
+
+        __m128 sinPoly = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(-1.9515295891e-4f), z), _mm_set1_ps(8.3321608736e-3f));
+        sinPoly        = _mm_add_ps(_mm_mul_ps(sinPoly, z), _mm_set1_ps(-1.6666654611e-1f));
+        sinPoly        = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(sinPoly, z), r), r);
+
+        __m128 cosPoly = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(2.443315711809948e-5f), z), _mm_set1_ps(-1.388731625493765e-3f));
+        cosPoly        = _mm_add_ps(_mm_mul_ps(cosPoly, z), _mm_set1_ps(4.166664568298827e-2f));
+        cosPoly        = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(cosPoly, z), z), _mm_sub_ps(_mm_set1_ps(1.f), _mm_mul_ps(z, _mm_set1_ps(0.5f))));
+
+        // 奇數象限交換 sin/cos；sin 在象限 2、3 變號，cos 在象限 1、2 變號
+        __m128 const swapMask = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrant, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+        __m128 const sinSign  = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrant, _mm_set1_epi32(2)), 30));
+        __m128 const cosSign  = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrant, _mm_set1_epi32(1)), _mm_set1_epi32(2)), 30));
+
+        __m128 const sinValue = _mm_or_ps(_mm_and_ps(swapMask, cosPoly), _mm_andnot_ps(swapMask, sinPoly));
+        __m128 const cosValue = _mm_or_ps(_mm_and_ps(swapMask, sinPoly), _mm_andnot_ps(swapMask, cosPoly));
+
+        outSin = _mm_xor_ps(sinValue, sinSign);
+        outCos = _mm_xor_ps(cosValue, cosSign);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // 4 個矩陣同一個基底向量的 x、y、z、w 轉置成每個矩陣各自的 (x, y, z, w)，寫到 m_values[offset..offset+3]
+    //------------------------------------------------------------------------------------------------
+    void StoreBasis4(__m128 x, __m128 y, __m128 z, __m128 w, Mat44* const (&outTransforms)[4], int const offset)
+    {
+        _MM_TRANSPOSE4_PS(x, y, z, w);
+
+        _mm_storeu_ps(outTransforms[0]->m_values + offset, x);
+        _mm_storeu_ps(outTransforms[1]->m_values + offset, y);
+        _mm_storeu_ps(outTransforms[2]->m_values + offset, z);
+        _mm_storeu_ps(outTransforms[3]->m_values + offset, w);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void sTransformBatch4::SetLane(int const lane, Vec3 const& position, EulerAngles const& orientation)
+{
+    m_positionX[lane]    = position.x;
+    m_positionY[lane]    = position.y;
+    m_positionZ[lane]    = position.z;
+    m_yawDegrees[lane]   = orientation.m_yawDegrees;
+    m_pitchDegrees[lane] = orientation.m_pitchDegrees;
+    m_rollDegrees[lane]  = orientation.m_rollDegrees;
+}
+
+//----------------------------------------------------------------------------------------------------
+// R = Rz * Ry * Rx 展開後：
+//   I = ( cy*cp,              sy*cp,              -sp   )
+//   J = ( cy*sp*sr - sy*cr,   sy*sp*sr + cy*cr,   cp*sr )
+//   K = ( cy*sp*cr + sy*sr,   sy*sp*cr - cy*sr,   cp*cr )
+//----------------------------------------------------------------------------------------------------
+void BuildModelToWorldTransforms4(sTransformBatch4 const& batch, Mat44* const (&outTransforms)[4])
+{
+    __m128 const degreesToRadians = _mm_set1_ps(0.01745329251994329577f);
+
+    __m128 sy, cy, sp, cp, sr, cr;
+    SinCos4(_mm_mul_ps(_mm_load_ps(batch.m_yawDegrees), degreesToRadians), sy, cy);
+    SinCos4(_mm_mul_ps(_mm_load_ps(batch.m_pitchDegrees), degreesToRadians), sp, cp);
+    SinCos4(_mm_mul_ps(_mm_load_ps(batch.m_rollDegrees), degreesToRadians), sr, cr);
+
+    __m128 const cysp = _mm_mul_ps(cy, sp);
+    __m128 const sysp = _mm_mul_ps(sy, sp);
+    __m128 const zero = _mm_setzero_ps();
+    __m128 const one  = _mm_set1_ps(1.f);
+
+    __m128 const ix = _mm_mul_ps(cy, cp);
+    __m128 const iy = _mm_mul_ps(sy, cp);
+    __m128 const iz = _mm_sub_ps(zero, sp);
+
+    __m128 const jx = _mm_sub_ps(_mm_mul_ps(cysp, sr), _mm_mul_ps(sy, cr));
+    __m128 const jy = _mm_add_ps(_mm_mul_ps(sysp, sr), _mm_mul_ps(cy, cr));
+    __m128 const jz = _mm_mul_ps(cp, sr);
+
+    __m128 const kx = _mm_add_ps(_mm_mul_ps(cysp, cr), _mm_mul_ps(sy, sr));
+    __m128 const ky = _mm_sub_ps(_mm_mul_ps(sysp, cr), _mm_mul_ps(cy, sr));
+    __m128 const kz = _mm_mul_ps(cp, cr);
+
+    StoreBasis4(ix, iy, iz, zero, outTransforms, Mat44::Ix);
+    StoreBasis4(jx, jy, jz, zero, outTransforms, Mat44::Jx);
+    StoreBasis4(kx, ky, kz, zero, outTransforms, Mat44::Kx);
+    StoreBasis4(_mm_load_ps(batch.m_positionX), _mm_load_ps(batch.m_positionY), _mm_load_ps(batch.m_positionZ), one, outTransforms, Mat44::Tx);
+}
@@ -0,0 +1,38 @@
+//----------------------------------------------------------------------------------------------------
+// TransformBatch.hpp
+// 以 SSE 一次建立 4 個模型到世界矩陣 - 供快取矩陣的批次重建使用
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+#include "Engine/Math/EulerAngles.hpp"
+
+//----------------------------------------------------------------------------------------------------
+struct Mat44;
+struct Vec3;
+
+//----------------------------------------------------------------------------------------------------
+// 4 個變換的 SoA 輸入，每個陣列的第 n 個元素屬於第 n 個矩陣
+//----------------------------------------------------------------------------------------------------
+struct sTransformBatch4
+{
+    alignas(16) float m_positionX[4]    = {};
+    alignas(16) float m_positionY[4]    = {};
+    alignas(16) float m_positionZ[4]    = {};
+    alignas(16) float m_yawDegrees[4]   = {};
+    alignas(16) float m_pitchDegrees[4] = {};
+    alignas(16) float m_rollDegrees[4]  = {};
+
+    void SetLane(int lane, Vec3 const& position, EulerAngles const& orientation);
+};
+
+//----------------------------------------------------------------------------------------------------
+// 與 Entity::GetModelToWorldTransform 相同的 T * Rz(yaw) * Ry(pitch) * Rx(roll)；
+// 4 組 sin/cos 以多項式一起計算，結果與逐一呼叫 Append*Rotation 的差距約 1e-6（角度累積到數千度時約 1e-5）
+//----------------------------------------------------------------------------------------------------
+void BuildModelToWorldTransforms4(sTransformBatch4 const& batch, Mat44* const (&outTransforms)[4]);
+
+//----------------------------------------------------------------------------------------------------
+inline bool AreOrientationsEqual(EulerAngles const& a, EulerAngles const& b)
+{
+    return a.m_yawDegrees == b.m_yawDegrees && a.m_pitchDegrees == b.m_pitchDegrees && a.m_rollDegrees == b.m_rollDegrees;
+}
@@ -0,0 +1,99 @@
+//----------------------------------------------------------------------------------------------------
+// ViewFrustum.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/ViewFrustum.hpp"
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include <cmath>
+#include <xmmintrin.h>
+
+//----------------------------------------------------------------------------------------------------
+// 側面平面包含相機位置與視錐的一條邊：例如左側面的邊方向為 forward + left * tanH，
+// 與它垂直且朝內的法向量為 forward * tanH - left，正規化後即為平面法向量
+//----------------------------------------------------------------------------------------------------
+STATIC ViewFrustum ViewFrustum::CreatePerspective(sPerspectiveView const& view)
+{
+    Vec3 forward;
+    Vec3 left;
+    Vec3 up;
+    view.m_orientation.GetAsVectors_IFwd_JLeft_KUp(forward, left, up);
+
+    Vec3 const& position      = view.m_position;
+    float const tanVertical   = view.GetTanHalfVerticalFov();
+    float const tanHorizontal = tanVertical * view.m_aspect;
+
+    Vec3 const leftNormal   = (forward * tanHorizontal - left) / std::sqrt(1.f + tanHorizontal * tanHorizontal);
+    Vec3 const rightNormal  = (forward * tanHorizontal + left) / std::sqrt(1.f + tanHorizontal * tanHorizontal);
+    Vec3 const topNormal    = (forward * tanVertical - up) / std::sqrt(1.f + tanVertical * tanVertical);
+    Vec3 const bottomNormal = (forward * tanVertical + up) / std::sqrt(1.f + tanVertical * tanVertical);
+
+    float const forwardDistance = DotProduct3D(forward, position);
+
+    ViewFrustum frustum;
+    frustum.SetPlane(0, forward, -(forwardDistance + view.m_nearZ));
+    frustum.SetPlane(1, -forward, forwardDistance + view.m_farZ);
+    frustum.SetPlane(2, leftNormal, -DotProduct3D(leftNormal, position));
+    frustum.SetPlane(3, rightNormal, -DotProduct3D(rightNormal, position));
+    frustum.SetPlane(4, topNormal, -DotProduct3D(topNormal, position));
+    frustum.SetPlane(5, bottomNormal, -DotProduct3D(bottomNormal, position));
+    frustum.SetPlane(6, bottomNormal, -DotProduct3D(bottomNormal, position));
+    frustum.SetPlane(7, bottomNormal, -DotProduct3D(bottomNormal, position));
+
+    return frustum;
+}
+
+//----------------------------------------------------------------------------------------------------
+// AABB 以中心 c、半徑向量 e 表示：對法向量 n，盒子在 n 方向的投影半徑為 |n|·e。
+// n·c + d < -r 表示整個盒子在平面外側；任何平面如此即為 OUTSIDE。
+// 所有平面都滿足 n·c + d >= r 時盒子完全在內側，子節點不需再測試。
+//----------------------------------------------------------------------------------------------------
+eCullResult ViewFrustum::TestAabb(AABB3 const& bounds) const
+{
+    __m128 const half    = _mm_set1_ps(0.5f);
+    __m128 const centerX = _mm_mul_ps(_mm_set1_ps(bounds.m_mins.x + bounds.m_maxs.x), half);
+    __m128 const centerY = _mm_mul_ps(_mm_set1_ps(bounds.m_mins.y + bounds.m_maxs.y), half);
+    __m128 const centerZ = _mm_mul_ps(_mm_set1_ps(bounds.m_mins.z + bounds.m_maxs.z), half);
+    __m128 const extentX = _mm_mul_ps(_mm_set1_ps(bounds.m_maxs.x - bounds.m_mins.x), half);
+    __m128 const extentY = _mm_mul_ps(_mm_set1_ps(bounds.m_maxs.y - bounds.m_mins.y), half);
+    __m128 const extentZ = _mm_mul_ps(_mm_set1_ps(bounds.m_maxs.z - bounds.m_mins.z), half);
+
+    int outsideMask      = 0;
+    int intersectingMask = 0;
+
+    for (int planeIndex = 0; planeIndex < 8; planeIndex += 4)
+    {
+        __m128 distance = _mm_load_ps(m_distance + planeIndex);
+        distance        = _mm_add_ps(distance, _mm_mul_ps(_mm_load_ps(m_normalX + planeIndex), centerX));
+        distance        = _mm_add_ps(distance, _mm_mul_ps(_mm_load_ps(m_normalY + planeIndex), centerY));
+        distance        = _mm_add_ps(distance, _mm_mul_ps(_mm_load_ps(m_normalZ + planeIndex), centerZ));
+
+        __m128 radius = _mm_mul_ps(_mm_load_ps(m_absNormalX + planeIndex), extentX);
+        radius        = _mm_add_ps(radius, _mm_mul_ps(_mm_load_ps(m_absNormalY + planeIndex), extentY));
+        radius        = _mm_add_ps(radius, _mm_mul_ps(_mm_load_ps(m_absNormalZ + planeIndex), extentZ));
+
+        outsideMask |= _mm_movemask_ps(_mm_cmplt_ps(_mm_add_ps(distance, radius), _mm_setzero_ps()));
+        intersectingMask |= _mm_movemask_ps(_mm_cmplt_ps(_mm_sub_ps(distance, radius), _mm_setzero_ps()));
+    }
+
+    if (outsideMask != 0)
+    {
+        return eCullResult::OUTSIDE;
+    }
+
+    return intersectingMask != 0 ? eCullResult::INTERSECTING : eCullResult::INSIDE;
+}
+
+//----------------------------------------------------------------------------------------------------
+void ViewFrustum::SetPlane(int const planeIndex, Vec3 const& normal, float const distance)
+{
+    m_normalX[planeIndex]    = normal.x;
+    m_normalY[planeIndex]    = normal.y;
+    m_normalZ[planeIndex]    = normal.z;
+    m_absNormalX[planeIndex] = std::fabs(normal.x);
+    m_absNormalY[planeIndex] = std::fabs(normal.y);
+    m_absNormalZ[planeIndex] = std::fabs(normal.z);
+    m_distance[planeIndex]   = distance;
+}
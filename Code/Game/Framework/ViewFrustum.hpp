@@ -0,0 +1,61 @@
+//----------------------------------------------------------------------------------------------------
+// ViewFrustum.hpp
+// 透視相機的視錐 - 6 個平面，以 SSE 一次測試 4 個平面與 AABB 的關係
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/EulerAngles.hpp"
+#include "Engine/Math/Vec3.hpp"
+#include <cmath>
+#include <cstdint>
+
+//----------------------------------------------------------------------------------------------------
+enum class eCullResult : uint8_t
+{
+    OUTSIDE,
+    INTERSECTING,
+    INSIDE
+};
+
+//----------------------------------------------------------------------------------------------------
+// 透視相機的參數，與 Camera::SetPerspectiveGraphicView 相同：aspect 為寬／高，fovDegrees 為垂直視角；
+// 相機朝 +I（前）、+J（左）、+K（上）
+//----------------------------------------------------------------------------------------------------
+struct sPerspectiveView
+{
+    Vec3        m_position;
+    EulerAngles m_orientation;
+    float       m_aspect     = 2.f;
+    float       m_fovDegrees = 60.f;
+    float       m_nearZ      = 0.1f;
+    float       m_farZ       = 100.f;
+
+    float GetTanHalfVerticalFov() const { return std::tan(m_fovDegrees * 0.5f * 0.01745329251994329577f); }
+};
+
+//----------------------------------------------------------------------------------------------------
+// 平面以 SoA 存放並補到 8 個（重複最後一個平面），SIMD 測試不需要處理剩餘的平面。
+// 法向量朝內，點 p 在平面內側時 n·p + d >= 0。
+// 預設建構的視錐沒有任何平面限制，所有 AABB 都是 INSIDE（沒有相機時等同不剔除）。
+// 只依賴數學型別，不需要 Renderer，可在沒有視窗的工具或測試中使用。
+//----------------------------------------------------------------------------------------------------
+class ViewFrustum
+{
+public:
+    static ViewFrustum CreatePerspective(sPerspectiveView const& view);
+
+    eCullResult TestAabb(AABB3 const& bounds) const;
+    bool        IsAabbVisible(AABB3 const& bounds) const { return TestAabb(bounds) != eCullResult::OUTSIDE; }
+
+private:
+    void SetPlane(int planeIndex, Vec3 const& normal, float distance);
+
+    alignas(16) float m_normalX[8]    = {};
+    alignas(16) float m_normalY[8]    = {};
+    alignas(16) float m_normalZ[8]    = {};
+    alignas(16) float m_absNormalX[8] = {};
+    alignas(16) float m_absNormalY[8] = {};
+    alignas(16) float m_absNormalZ[8] = {};
+    alignas(16) float m_distance[8]   = {};
+};
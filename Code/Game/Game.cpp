@@ -10,6 +10,7 @@
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Input/InputSystem.hpp"
+#include "Engine/Math/MathUtils.hpp"
 #include "Engine/Math/RandomNumberGenerator.hpp"
 #include "Engine/Platform/Window.hpp"
 #include "Engine/Renderer/BitmapFont.hpp"
@@ -20,9 +21,32 @@
 #include "Engine/Resource/ResourceLoader/ObjModelLoader.hpp"
 #include "Engine/Scripting/V8Subsystem.hpp"
 #include "Game/Framework/App.hpp"
+#include "Game/Framework/FrameProfiler.hpp"
 #include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/IndexedMesh.hpp"
+#include "Game/Framework/JobSystem.hpp"
+#include "Game/Framework/MeshLod.hpp"
 #include "Game/Player.hpp"
 #include "Game/Prop.hpp"
+#include <algorithm>
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    // 已保留控制代碼、但建立指令尚未套用的方塊
+    uint32_t constexpr PENDING_PROP_INDEX = UINT32_MAX;
+
+    // ParallelFor 每段的最少道具數；積分只是幾個乘加，分段要夠大才抵得過排程成本
+    uint32_t constexpr PROP_UPDATE_GRAIN_SIZE = 4096;
+    uint32_t constexpr PROP_RENDER_GRAIN_SIZE = 512;
+    uint32_t constexpr PROP_OCCLUSION_GRAIN_SIZE = 256;
+
+    // 每幀最多光柵化的遮擋物數（離相機最近的方塊）；越多遮得越完整，但光柵化成本隨之增加
+    uint32_t constexpr MAX_OCCLUDER_COUNT = 64;
+
+    // 遮擋剔除與 LOD 選擇共用的結果陣列中，表示道具被遮擋
+    uint8_t constexpr OCCLUDED_LOD_LEVEL = UINT8_MAX;
+}
 
 //----------------------------------------------------------------------------------------------------
 Game::Game()
@@ -46,6 +70,12 @@ Game::Game()
     m_sphere->m_position     = Vec3(10, -5, 1);
     m_grid->m_position       = Vec3::ZERO;
 
+    m_player->SavePreviousTransform();
+    m_firstCube->SavePreviousTransform();
+    m_secondCube->SavePreviousTransform();
+    m_sphere->SavePreviousTransform();
+    m_grid->SavePreviousTransform();
+
     DebugAddWorldBasis(Mat44(), -1.f);
 
     Mat44 transform;
@@ -69,12 +99,12 @@ Game::~Game()
 {
     DebuggerPrintf("遊戲關閉中...\n");
 
-    // 清理物件（保持原本的清理邏輯）
-    for (Prop* prop : m_props)
-    {
-        delete prop;
-    }
-    m_props.clear();
+    // 先停止腳本工作執行緒，確保之後釋放物件時沒有腳本仍在執行
+    DisableScriptWorker();
+
+    // 清理物件
+    m_props.Clear();
+    m_propCullTree.Clear();
 
     delete m_gameClock;
     m_gameClock = nullptr;
@@ -119,12 +149,6 @@ void Game::Startup()
     SpawnPlayer();
     SpawnProp();
 
-    // 初始化 props 向量
-    if (m_firstCube) m_props.push_back(m_firstCube);
-    if (m_secondCube) m_props.push_back(m_secondCube);
-    if (m_sphere) m_props.push_back(m_sphere);
-    if (m_grid) m_props.push_back(m_grid);
-
     m_gameState = eGameState::GAME;
 
     DebuggerPrintf("遊戲啟動完成！\n");
@@ -137,11 +161,19 @@ void Game::Shutdown()
 //----------------------------------------------------------------------------------------------------
 void Game::Update()
 {
+    PROFILE_SCOPE("Game::Update");
+
     // 原本的更新邏輯
     float const gameDeltaSeconds   = static_cast<float>(m_gameClock->GetDeltaSeconds());
     float const systemDeltaSeconds = static_cast<float>(Clock::GetSystemClock().GetDeltaSeconds());
 
+    StorePropLodLevels();
+    CommitScriptWorkerCommands();
+    ApplyPropTransformBuffer(true);
+    ApplyScriptCommands();
+    ApplyPropTransformBuffer(false);
     UpdateEntities(gameDeltaSeconds, systemDeltaSeconds);
+    SyncPropTransformBuffer();
     UpdateFromKeyBoard();
     UpdateFromController();
 
@@ -155,11 +187,15 @@ void Game::Update()
         RunJavaScriptTests();
         m_hasRunJSTests = true;
     }
+
+    PublishScriptWorkerSnapshot();
 }
 
 //----------------------------------------------------------------------------------------------------
 void Game::Render() const
 {
+    PROFILE_SCOPE("Game::Render");
+
     //-Start-of-Game-Camera---------------------------------------------------------------------------
 
     g_theRenderer->BeginCamera(*m_player->GetCamera());
@@ -177,10 +213,19 @@ void Game::Render() const
         DebugAddScreenText(Stringf("ClientDimensions=(%.1f,%.1f)", clientDimensions.x, clientDimensions.y), Vec2(0, 40), 20.f, Vec2::ZERO, 0.f);
         DebugAddScreenText(Stringf("WindowPosition=(%.1f,%.1f)", windowPosition.x, windowPosition.y), Vec2(0, 60), 20.f, Vec2::ZERO, 0.f);
         DebugAddScreenText(Stringf("ClientPosition=(%.1f,%.1f)", clientPosition.x, clientPosition.y), Vec2(0, 80), 20.f, Vec2::ZERO, 0.f);
+        DebugAddScreenText(Stringf("Props=%zu (%d batches, %u transforms rebuilt)", m_props.GetCount(), m_propDrawCount, m_propTransformRebuildCount), Vec2(0, 140), 20.f, Vec2::ZERO, 0.f);
+        sRenderQueueStats const& queueStats = m_renderQueue.GetLastStats();
+        DebugAddScreenText(Stringf("RenderQueue=%d cmds, state changes %d applied / %d avoided", queueStats.m_commandCount, queueStats.m_stateChangesApplied, queueStats.m_stateChangesAvoided), Vec2(0, 160), 20.f, Vec2::ZERO, 0.f);
+        sFramePacerStats const& paceStats = g_theApp->GetFramePacer().GetLastStats();
+        DebugAddScreenText(Stringf("FrameTime p50/p95/p99=%.2f/%.2f/%.2f ms (target %.0f fps, %s)", paceStats.m_p50Ms, paceStats.m_p95Ms, paceStats.m_p99Ms, g_theApp->GetFramePacer().GetTargetFps(), PowerPolicy::GetStateName(g_theApp->GetPowerPolicy().GetState())), Vec2(0, 180), 20.f, Vec2::ZERO, 0.f);
+        DebugAddScreenText(Stringf("SimSteps=%u/%u per frame (step %.1f ms, dropped %.2f s)", m_fixedTimestep.GetLastStepCount(), m_fixedTimestep.GetMaxStepsPerFrame(), m_fixedTimestep.GetStepSeconds() * 1000.f, m_fixedTimestep.GetDroppedSeconds()), Vec2(0, 200), 20.f, Vec2::ZERO, 0.f);
+        DebugAddScreenText(Stringf("Culling=%u visible / %u culled / %u occluded (BVH height %d, %d nodes, %u occluders)", m_visibleCount, m_culledCount, m_occludedCount, m_propCullTree.GetHeight(), m_propCullTree.GetNodeCount(), m_occlusionBuffer.GetOccluderCount()), Vec2(0, 220), 20.f, Vec2::ZERO, 0.f);
+        DebugAddScreenText(Stringf("LOD=%u / %u / %u / %u visible per level", m_lodLevelCounts[0], m_lodLevelCounts[1], m_lodLevelCounts[2], m_lodLevelCounts[3]), Vec2(0, 240), 20.f, Vec2::ZERO, 0.f);
         // 新增：JavaScript 狀態顯示
         if (g_theV8Subsystem)
         {
             std::string jsStatus = g_theV8Subsystem->IsInitialized() ? "JS: 已啟用" : "JS: 未啟用";
+            jsStatus += Stringf(" (Scheduler %.2f / %.2f ms)", m_scriptScheduler.GetLastTickMs(), m_scriptScheduler.GetFrameBudgetMs());
             DebugAddScreenText(jsStatus, Vec2(0, 100), 20.f, Vec2::ZERO, 0.f);
 
             if (g_theV8Subsystem->HasError())
@@ -213,6 +258,11 @@ void Game::Render() const
     //-End-of-Screen-Camera---------------------------------------------------------------------------
     if (m_gameState == eGameState::GAME)
     {
+        if (FrameProfiler::IsOverlayVisible())
+        {
+            RenderProfilerOverlay();
+        }
+
         DebugRenderScreen(*m_screenCamera);
     }
 }
@@ -381,30 +431,30 @@ void Game::UpdateFromController()
 }
 
 //----------------------------------------------------------------------------------------------------
-void Game::UpdateEntities(float const gameDeltaSeconds, float const systemDeltaSeconds) const
+void Game::UpdateEntities(float const gameDeltaSeconds, float const systemDeltaSeconds)
 {
-    // 更新玩家
+    PROFILE_SCOPE("Game::UpdateEntities");
+
+    // 輸入每幀取樣一次（滑鼠視角直接套用），移動與旋轉在固定步長中積分
     if (m_player)
     {
-        m_player->Update(gameDeltaSeconds);
+        m_player->UpdateFromInput();
     }
 
-    // 更新所有物件
-    for (Prop* prop : m_props)
+    // 遊戲時鐘暫停時幀時間為 0，不會產生任何步數
+    uint32_t const numSteps = m_fixedTimestep.Advance(gameDeltaSeconds);
+
+    for (uint32_t stepIndex = 0; stepIndex < numSteps; ++stepIndex)
     {
-        if (prop)
-        {
-            prop->Update(gameDeltaSeconds);
-        }
+        StepSimulation(m_fixedTimestep.GetStepSeconds());
+    }
+
+    if (m_player)
+    {
+        m_player->UpdateCamera(m_fixedTimestep.GetAlpha());
     }
-    // m_player->Update(systemDeltaSeconds);
-    // m_firstCube->Update(gameDeltaSeconds);
-    // m_secondCube->Update(gameDeltaSeconds);
-    // m_sphere->Update(gameDeltaSeconds);
-    // m_grid->Update(gameDeltaSeconds);
 
-    m_firstCube->m_orientation.m_pitchDegrees += 30.f * gameDeltaSeconds;
-    m_firstCube->m_orientation.m_rollDegrees += 30.f * gameDeltaSeconds;
+    UpdatePropTransforms();
 
     float const time       = static_cast<float>(m_gameClock->GetTotalSeconds());
     float const colorValue = (sinf(time) + 1.0f) * 0.5f * 255.0f;
@@ -413,11 +463,68 @@ void Game::UpdateEntities(float const gameDeltaSeconds, float const systemDeltaS
     m_secondCube->m_color.g = static_cast<unsigned char>(colorValue);
     m_secondCube->m_color.b = static_cast<unsigned char>(colorValue);
 
-    m_sphere->m_orientation.m_yawDegrees += 45.f * gameDeltaSeconds;
-
     DebugAddScreenText(Stringf("Time: %.2f\nFPS: %.2f\nScale: %.1f", m_gameClock->GetTotalSeconds(), 1.f / m_gameClock->GetDeltaSeconds(), m_gameClock->GetTimeScale()), m_screenCamera->GetOrthographicTopRight() - Vec2(250.f, 60.f), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
 }
 
+//----------------------------------------------------------------------------------------------------
+// 一個固定步長的模擬；每步開始前保存目前的變換，繪製時在這一步的前後之間內插
+//----------------------------------------------------------------------------------------------------
+void Game::StepSimulation(float const stepSeconds)
+{
+    m_player->SavePreviousTransform();
+    m_firstCube->SavePreviousTransform();
+    m_secondCube->SavePreviousTransform();
+    m_sphere->SavePreviousTransform();
+    m_grid->SavePreviousTransform();
+
+    m_player->Update(stepSeconds);
+
+    // 更新所有物件（對連續的方向、角速度陣列做一次積分，取代逐一呼叫 Prop::Update），依索引範圍分段平行執行
+    g_theJobSystem->ParallelFor(static_cast<uint32_t>(m_props.GetCount()), PROP_UPDATE_GRAIN_SIZE, [this, stepSeconds](uint32_t const begin, uint32_t const end) {
+        m_props.SavePreviousOrientations(begin, end);
+        m_props.IntegrateAngularVelocities(stepSeconds, begin, end);
+    });
+
+    m_firstCube->m_orientation.m_pitchDegrees += 30.f * stepSeconds;
+    m_firstCube->m_orientation.m_rollDegrees += 30.f * stepSeconds;
+
+    m_sphere->m_orientation.m_yawDegrees += 45.f * stepSeconds;
+}
+
+//----------------------------------------------------------------------------------------------------
+// 只重建快取已失效或仍在兩步之間旋轉的道具矩陣；靜止的道具沒有任何變換計算
+//----------------------------------------------------------------------------------------------------
+void Game::UpdatePropTransforms()
+{
+    PROFILE_SCOPE("Game::UpdatePropTransforms");
+
+    float const           alpha = m_fixedTimestep.GetAlpha();
+    std::atomic<uint32_t> rebuiltCount = 0;
+
+    g_theJobSystem->ParallelFor(static_cast<uint32_t>(m_props.GetCount()), PROP_RENDER_GRAIN_SIZE, [this, alpha, &rebuiltCount](uint32_t const begin, uint32_t const end) {
+        rebuiltCount.fetch_add(m_props.UpdateModelToWorldTransforms(alpha, begin, end), std::memory_order_relaxed);
+    });
+
+    m_propTransformRebuildCount = rebuiltCount.load();
+}
+
+//----------------------------------------------------------------------------------------------------
+// 上一幀各區塊的耗時，由畫面左上角往下排列，隨 DebugRenderScreen 畫在螢幕相機上
+//----------------------------------------------------------------------------------------------------
+void Game::RenderProfilerOverlay() const
+{
+    float constexpr lineHeight = 16.f;
+    Vec2 const      topLeft    = Vec2(0.f, m_screenCamera->GetOrthographicTopRight().y);
+
+    std::vector<std::string> const lines = FrameProfiler::BuildOverlayLines(40);
+
+    for (size_t lineIndex = 0; lineIndex < lines.size(); ++lineIndex)
+    {
+        Vec2 const position = topLeft - Vec2(0.f, lineHeight * static_cast<float>(lineIndex + 1));
+        DebugAddScreenText(lines[lineIndex], position, lineHeight, Vec2::ZERO, 0.f, Rgba8::YELLOW, Rgba8::YELLOW);
+    }
+}
+
 //----------------------------------------------------------------------------------------------------
 void Game::RenderAttractMode() const
 {
@@ -435,21 +542,247 @@ void Game::RenderAttractMode() const
     g_theRenderer->DrawVertexArray(verts);
 }
 
+//----------------------------------------------------------------------------------------------------
+// 道具先送進繪製佇列，排序後一次重播，相同的繪製狀態不重複設定；在玩家相機視錐外的道具不送出
 //----------------------------------------------------------------------------------------------------
 void Game::RenderEntities() const
 {
-    m_firstCube->Render();
-    m_secondCube->Render();
-    m_sphere->Render();
-    m_grid->Render();
+    PROFILE_SCOPE("Game::RenderEntities");
+
+    float const alpha        = m_fixedTimestep.GetAlpha();
+    Vec3 const  viewPosition = m_player->GetInterpolatedPosition(alpha);
+
+    m_renderQueue.Reset();
+    m_visibleCount  = 0;
+    m_culledCount   = 0;
+    m_occludedCount = 0;
+    std::fill(std::begin(m_lodLevelCounts), std::end(m_lodLevelCounts), 0u);
+    m_fixedPropLodLevels.clear();
+
+    SubmitIfVisible(m_firstCube, viewPosition, alpha);
+    SubmitIfVisible(m_secondCube, viewPosition, alpha);
+    SubmitIfVisible(m_sphere, viewPosition, alpha);
+    SubmitIfVisible(m_grid, viewPosition, alpha);
+
+    RenderScriptProps();
 
-    g_theRenderer->SetModelConstants(m_player->GetModelToWorldTransform());
+    m_renderQueue.Execute();
+
+    g_theRenderer->SetModelConstants(m_player->GetInterpolatedModelToWorldTransform(alpha));
     m_player->Render();
+}
+
+//----------------------------------------------------------------------------------------------------
+// 固定場景的道具只有幾個，直接以視錐測試，不放進 m_propCullTree；可見時選擇 LOD。
+// 與腳本道具相同，Render 不修改道具：選出的層級直接用於本次繪製，並在下一次 Update 由 StorePropLodLevels 寫回
+//----------------------------------------------------------------------------------------------------
+void Game::SubmitIfVisible(Prop* prop, Vec3 const& viewPosition, float const alpha) const
+{
+    if (!m_player->GetViewFrustum().IsAabbVisible(prop->GetWorldBounds()))
+    {
+        ++m_culledCount;
+        return;
+    }
+
+    uint8_t const lodLevel = prop->SelectLod(viewPosition, m_player->GetView().GetTanHalfVerticalFov());
+    m_fixedPropLodLevels.emplace_back(prop, lodLevel);
+
+    ++m_visibleCount;
+    ++m_lodLevelCounts[lodLevel];
+    prop->SubmitToRenderQueue(m_renderQueue, viewPosition, alpha, lodLevel);
+}
+
+//----------------------------------------------------------------------------------------------------
+// 以 m_propCullTree 找出視錐內的道具，再剔除被遮擋的道具；共用 mesh 與材質的道具合併成一個批次，每個批次是繪製佇列中的一個指令
+//----------------------------------------------------------------------------------------------------
+void Game::RenderScriptProps() const
+{
+    m_propDrawCount = 0;
+
+    if (m_props.IsEmpty())
+    {
+        return;
+    }
+
+    m_visiblePropIndices.clear();
+    m_propCullTree.QueryFrustum(m_player->GetViewFrustum(), [this](uint32_t const propIndex) {
+        m_visiblePropIndices.push_back(propIndex);
+    });
+
+    m_culledCount += static_cast<uint32_t>(m_props.GetCount() - m_visiblePropIndices.size());
+
+    CullPropsAndSelectLods();
+
+    uint32_t const visiblePropCount = static_cast<uint32_t>(m_visiblePropIndices.size());
+
+    m_visibleCount += visiblePropCount;
+
+    if (visiblePropCount == 0)
+    {
+        return;
+    }
+
+    Shader* const                   shader  = m_propShader;
+    std::span<Rgba8 const> const    colors  = m_props.GetColors();
+    std::span<uint32_t const> const meshIds = m_props.GetMeshIds();
+
+    m_propBatcher.Reset();
+    m_propBatcher.ResizePending(visiblePropCount);
+
+    // 矩陣已在 UpdatePropTransforms 快取、LOD 已在 CullPropsAndSelectLods 選好，這裡只複製；各批次項目彼此獨立，依索引範圍平行建立
+    g_theJobSystem->ParallelFor(visiblePropCount, PROP_RENDER_GRAIN_SIZE, [&](uint32_t const begin, uint32_t const end) {
+        for (uint32_t visibleIndex = begin; visibleIndex < end; ++visibleIndex)
+        {
+            uint32_t const propIndex = m_visiblePropIndices[visibleIndex];
+            uint32_t const meshId    = m_meshRegistry.GetLodMeshId(meshIds[propIndex], m_visiblePropLodLevels[visibleIndex]);
+
+            m_propBatcher.SetInstance(visibleIndex, meshId, shader, nullptr, m_props.GetCachedModelToWorldTransform(propIndex), colors[propIndex]);
+        }
+    });
+
+    m_propBatcher.Build();
+
+    RenderQueueBackend queueBackend(m_renderQueue, m_propRenderBackend, eRenderPass::WORLD_OPAQUE, sRenderState{});
+    m_propDrawCount = m_propBatcher.Submit(queueBackend, m_meshRegistry);
+}
+
+//----------------------------------------------------------------------------------------------------
+// 離相機最近的方塊作為遮擋物，光柵化到低解析度的深度緩衝區（每個 tile 一個工作）；沒有遮擋物時回傳 false
+//----------------------------------------------------------------------------------------------------
+bool Game::RasterizePropOccluders() const
+{
+    PROFILE_SCOPE("Game::RasterizePropOccluders");
+
+    sMeshEntry const* cubeMesh = m_meshRegistry.GetMesh(m_cubeMeshId);
+
+    if (!cubeMesh)
+    {
+        return false;
+    }
 
-    for (Prop* prop : m_props)
+    std::span<Vec3 const> const     positions    = m_props.GetPositions();
+    std::span<uint32_t const> const meshIds      = m_props.GetMeshIds();
+    Vec3 const&                     viewPosition = m_player->GetView().m_position;
+
+    m_occluderPropIndices.clear();
+
+    for (uint32_t const propIndex : m_visiblePropIndices)
+    {
+        if (meshIds[propIndex] == m_cubeMeshId)
+        {
+            m_occluderPropIndices.push_back(propIndex);
+        }
+    }
+
+    if (m_occluderPropIndices.empty())
+    {
+        return false;
+    }
+
+    if (m_occluderPropIndices.size() > MAX_OCCLUDER_COUNT)
+    {
+        std::nth_element(m_occluderPropIndices.begin(), m_occluderPropIndices.begin() + MAX_OCCLUDER_COUNT, m_occluderPropIndices.end(), [&](uint32_t const a, uint32_t const b) {
+            return GetDistanceSquared3D(positions[a], viewPosition) < GetDistanceSquared3D(positions[b], viewPosition);
+        });
+        m_occluderPropIndices.resize(MAX_OCCLUDER_COUNT);
+    }
+
+    m_occlusionBuffer.BeginFrame(m_player->GetView());
+
+    for (uint32_t const propIndex : m_occluderPropIndices)
     {
-        prop->Render();
+        m_occlusionBuffer.AddOccluderBox(m_props.GetCachedModelToWorldTransform(propIndex), cubeMesh->m_localBounds);
     }
+
+    m_occlusionBuffer.Rasterize(g_theJobSystem);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// 平行測試 m_visiblePropIndices 中每個道具的包圍盒是否被遮擋，同一個迴圈中為可見的道具依螢幕大小選擇 LOD；
+// 最後只留下可見的道具與它們的 LOD 層級。遮擋物自己的包圍盒包住方塊，最近的深度一定比方塊表面近，不會把自己遮住。
+// 每個工作只寫入自己範圍內的 m_visiblePropLodLevels，不修改 m_props；選出的層級在下一次 Update 由 StorePropLodLevels 寫回。
+//----------------------------------------------------------------------------------------------------
+void Game::CullPropsAndSelectLods() const
+{
+    PROFILE_SCOPE("Game::CullPropsAndSelectLods");
+
+    bool const                      hasOccluders       = RasterizePropOccluders();
+    std::span<Vec3 const> const     positions          = m_props.GetPositions();
+    std::span<uint32_t const> const meshIds            = m_props.GetMeshIds();
+    Vec3 const&                     viewPosition       = m_player->GetView().m_position;
+    float const                     tanHalfVerticalFov = m_player->GetView().GetTanHalfVerticalFov();
+    uint32_t const                  candidateCount     = static_cast<uint32_t>(m_visiblePropIndices.size());
+
+    m_visiblePropLodLevels.resize(candidateCount);
+
+    g_theJobSystem->ParallelFor(candidateCount, PROP_OCCLUSION_GRAIN_SIZE, [&](uint32_t const begin, uint32_t const end) {
+        for (uint32_t candidateIndex = begin; candidateIndex < end; ++candidateIndex)
+        {
+            uint32_t const propIndex = m_visiblePropIndices[candidateIndex];
+
+            if (hasOccluders && !m_occlusionBuffer.IsAabbVisible(GetPropCullBounds(propIndex)))
+            {
+                m_visiblePropLodLevels[candidateIndex] = OCCLUDED_LOD_LEVEL;
+                continue;
+            }
+
+            sMeshEntry const* mesh     = m_meshRegistry.GetMesh(meshIds[propIndex]);
+            uint8_t           lodLevel = 0;
+
+            if (mesh && mesh->m_lodChain.m_levelCount > 1)
+            {
+                float const screenSize = GetProjectedScreenSize(mesh->m_boundingRadius, GetDistance3D(positions[propIndex], viewPosition), tanHalfVerticalFov);
+                lodLevel               = mesh->m_lodChain.SelectLevel(screenSize, m_props.GetLodLevel(propIndex));
+            }
+
+            m_visiblePropLodLevels[candidateIndex] = lodLevel;
+        }
+    });
+
+    uint32_t visibleCount = 0;
+
+    for (uint32_t candidateIndex = 0; candidateIndex < candidateCount; ++candidateIndex)
+    {
+        uint8_t const lodLevel = m_visiblePropLodLevels[candidateIndex];
+
+        if (lodLevel == OCCLUDED_LOD_LEVEL)
+        {
+            continue;
+        }
+
+        ++m_lodLevelCounts[lodLevel];
+        m_visiblePropIndices[visibleCount]   = m_visiblePropIndices[candidateIndex];
+        m_visiblePropLodLevels[visibleCount] = lodLevel;
+        ++visibleCount;
+    }
+
+    m_occludedCount = candidateCount - visibleCount;
+    m_visiblePropIndices.resize(visibleCount);
+    m_visiblePropLodLevels.resize(visibleCount);
+}
+
+//----------------------------------------------------------------------------------------------------
+// 把上一次 Render 為可見道具選出的 LOD 層級寫回 m_props 與固定場景的道具，供下一次選擇的遲滯使用。
+// 必須在任何建立或移除道具之前呼叫，m_visiblePropIndices 的索引才仍然對應同一個道具；寫回後清空，
+// 略過 Render 的幀不會重複寫入
+//----------------------------------------------------------------------------------------------------
+void Game::StorePropLodLevels()
+{
+    for (size_t visibleIndex = 0; visibleIndex < m_visiblePropIndices.size(); ++visibleIndex)
+    {
+        m_props.SetLodLevel(m_visiblePropIndices[visibleIndex], m_visiblePropLodLevels[visibleIndex]);
+    }
+
+    for (auto const& [prop, lodLevel] : m_fixedPropLodLevels)
+    {
+        prop->SetLodLevel(lodLevel);
+    }
+
+    m_visiblePropIndices.clear();
+    m_visiblePropLodLevels.clear();
+    m_fixedPropLodLevels.clear();
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -458,20 +791,68 @@ void Game::SpawnPlayer()
     m_player = new Player(this);
 }
 
+//----------------------------------------------------------------------------------------------------
+bool Game::SpawnCube(Vec3 const& position, Rgba8 const& color, sEntityHandle const reservedHandle)
+{
+    return AddProp(position, color, m_cubeMeshId, reservedHandle);
+}
+
+//----------------------------------------------------------------------------------------------------
+Rgba8 Game::GetRandomCubeColor() const
+{
+    return Rgba8(static_cast<unsigned char>(g_theRNG->RollRandomIntInRange(100, 255)),
+                 static_cast<unsigned char>(g_theRNG->RollRandomIntInRange(100, 255)),
+                 static_cast<unsigned char>(g_theRNG->RollRandomIntInRange(100, 255)),
+                 255);
+}
+
 //----------------------------------------------------------------------------------------------------
 void Game::SpawnProp()
 {
     Texture const* texture = g_theRenderer->CreateOrGetTextureFromFile("Data/Images/TestUV.png");
 
+    m_propShader = g_theRenderer->CreateOrGetShaderFromFile("Data/Shaders/Bloom", eVertexType::VERTEX_PCU);
+
+    // 每種形狀只產生一次頂點，之後所有道具（包含腳本建立的方塊）都以 mesh ID 引用。
+    // 三角形列表合併重複頂點成為索引 mesh，並依頂點快取重排三角形；展開後與原本的三角形逐位元組相同
+    std::vector<Vertex_PCU> vertexes;
+
+    auto const registerIndexedMesh = [this, &vertexes](std::string const& name) {
+        sIndexedMesh mesh;
+        AppendWeldedTriangles(mesh, vertexes);
+        OptimizeVertexCache(mesh.m_indexes, mesh.m_vertexes.size());
+        OptimizeVertexFetch(mesh);
+        vertexes.clear();
+
+        return m_meshRegistry.RegisterMesh(name, mesh.m_vertexes, mesh.m_indexes);
+    };
+
+    Prop::AddVertsForCube(vertexes);
+    m_cubeMeshId = registerIndexedMesh("Cube");
+
+    Prop::AddVertsForSphere(vertexes);
+    std::vector<Vertex_PCU> const sphereTriangles = vertexes;
+    uint32_t const                sphereMeshId    = registerIndexedMesh("Sphere");
+
+    // 球的低細節層級由完整的球以頂點聚類簡化；門檻為包圍球直徑佔畫面高度的比例
+    GenerateClusteredLod(sphereTriangles, 8, vertexes);
+    m_meshRegistry.AddLodLevel(sphereMeshId, registerIndexedMesh("Sphere_LOD1"), 0.12f);
+
+    GenerateClusteredLod(sphereTriangles, 4, vertexes);
+    m_meshRegistry.AddLodLevel(sphereMeshId, registerIndexedMesh("Sphere_LOD2"), 0.04f);
+
+    Prop::AddVertsForGrid(vertexes);
+    uint32_t const gridMeshId = registerIndexedMesh("Grid");
+
     m_firstCube  = new Prop(this);
     m_secondCube = new Prop(this);
     m_sphere     = new Prop(this, texture);
     m_grid       = new Prop(this);
 
-    m_firstCube->InitializeLocalVertsForCube();
-    m_secondCube->InitializeLocalVertsForCube();
-    m_sphere->InitializeLocalVertsForSphere();
-    m_grid->InitializeLocalVertsForGrid();
+    m_firstCube->SetMesh(m_cubeMeshId);
+    m_secondCube->SetMesh(m_cubeMeshId);
+    m_sphere->SetMesh(sphereMeshId);
+    m_grid->SetMesh(gridMeshId);
 }
 
 
@@ -481,6 +862,17 @@ void Game::SpawnProp()
 
 void Game::ExecuteJavaScriptCommand(const std::string& command)
 {
+    PROFILE_SCOPE("Game::ExecuteJavaScriptCommand");
+
+    if (m_scriptWorker)
+    {
+        if (!m_scriptWorker->SubmitScript(command))
+        {
+            DebuggerPrintf("腳本工作執行緒佇列已滿，捨棄指令: %s\n", command.c_str());
+        }
+        return;
+    }
+
     if (g_theV8Subsystem && g_theV8Subsystem->IsInitialized())
     {
         DebuggerPrintf("執行 JS 指令: %s\n", command.c_str());
@@ -509,9 +901,14 @@ void Game::ExecuteJavaScriptCommand(const std::string& command)
     }
 }
 
+//----------------------------------------------------------------------------------------------------
+// 暫緩：V8 code cache（以內容雜湊為鍵的 .v8cache）。V8Subsystem::ExecuteScriptFile 在引擎內自行讀檔並編譯，
+// 目前沒有提供讀入／產生 cached data 的介面，遊戲端無法接上；待引擎開放編譯鉤子後，在這裡傳入快取並於冷編譯後寫回
 //----------------------------------------------------------------------------------------------------
 void Game::ExecuteJavaScriptFile(const std::string& filename)
 {
+    PROFILE_SCOPE("Game::ExecuteJavaScriptFile");
+
     if (g_theV8Subsystem && g_theV8Subsystem->IsInitialized())
     {
         DebuggerPrintf("執行 JS 檔案: %s\n", filename.c_str());
@@ -555,42 +952,451 @@ void Game::HandleJavaScriptCommands()
     {
         ExecuteJavaScriptCommand("var pos = game.getPlayerPos(); console.log('玩家位置:', pos);");
     }
+
+    // 推進 JS 排程任務，單幀花費不超過 m_scriptScheduler 的預算
+    m_scriptScheduler.Tick(*m_gameClock);
+}
+
+//----------------------------------------------------------------------------------------------------
+// 以下四個腳本介面只記錄指令（移動寫入 m_propTransforms），實際修改 m_props 在下一次 Game::Update 開頭統一進行。
+// CreateCube / CreateCubes 入列時就保留控制代碼，腳本可以在同一幀內移動或移除剛建立的方塊。
+// 指令緩衝區是固定容量的環（指令數與 payload 位元組都有上限），放不下的指令直接捨棄並警告，不在腳本執行中途套用
+//----------------------------------------------------------------------------------------------------
+sEntityHandle Game::CreateCube(Vec3 const& position)
+{
+    sEntityHandle const handle = m_propHandles.Allocate(PENDING_PROP_INDEX);
+
+    if (!handle.IsValid())
+    {
+        DebuggerPrintf("警告：物件數量已達上限，無法建立方塊\n");
+        return handle;
+    }
+
+    if (!m_scriptCommands.PushCreateCube(position, handle))
+    {
+        DebuggerPrintf("警告：本幀的腳本指令已達上限，捨棄 createCube\n");
+        m_propHandles.Release(handle);
+        return {};
+    }
+
+    return handle;
+}
+
+//----------------------------------------------------------------------------------------------------
+// positions 為連續的 (x, y, z) 三元組；colors 若提供，數量需與方塊數相同，否則使用隨機顏色。
+// 與 CreateCube 相同，入列時就為每個方塊保留控制代碼並回傳給腳本；控制代碼不足時只建立拿到控制代碼的方塊
+//----------------------------------------------------------------------------------------------------
+std::vector<sEntityHandle> Game::CreateCubes(std::span<float const> const positions, std::span<Rgba8 const> const colors)
+{
+    size_t const numCubes = positions.size() / 3;
+
+    if (positions.size() % 3 != 0)
+    {
+        DebuggerPrintf("警告：createCubes 位置陣列長度 %zu 不是 3 的倍數，多餘的數值將被忽略\n", positions.size());
+    }
+
+    if (!colors.empty() && colors.size() < numCubes)
+    {
+        DebuggerPrintf("警告：createCubes 顏色數量 %zu 少於方塊數量 %zu，改用隨機顏色\n", colors.size(), numCubes);
+    }
+
+    std::vector<sEntityHandle> handles;
+    handles.reserve(numCubes);
+
+    for (size_t cubeIndex = 0; cubeIndex < numCubes; ++cubeIndex)
+    {
+        sEntityHandle const handle = m_propHandles.Allocate(PENDING_PROP_INDEX);
+
+        if (!handle.IsValid())
+        {
+            DebuggerPrintf("警告：物件數量已達上限，createCubes 只建立 %zu / %zu 個方塊\n", handles.size(), numCubes);
+            break;
+        }
+
+        handles.push_back(handle);
+    }
+
+    if (!m_scriptCommands.PushCreateCubes(positions, colors, handles))
+    {
+        DebuggerPrintf("警告：本幀的腳本指令已達上限，捨棄 createCubes（%zu 個方塊）\n", numCubes);
+
+        for (sEntityHandle const handle : handles)
+        {
+            m_propHandles.Release(handle);
+        }
+
+        handles.clear();
+    }
+
+    return handles;
 }
 
 //----------------------------------------------------------------------------------------------------
-void Game::CreateCube(Vec3 const& position)
+// 移動只寫入共用緩衝區的位置欄位，與 writeTransforms / writePositions 依寫入順序合併，最後寫入的值生效
+//----------------------------------------------------------------------------------------------------
+void Game::MoveProp(sEntityHandle const handle, Vec3 const& newPosition)
+{
+    if (!m_propHandles.IsValid(handle))
+    {
+        DebuggerPrintf("警告：JavaScript 請求移動無效的物件控制代碼 0x%08X\n", handle.m_value);
+        return;
+    }
+
+    float const xyz[3] = {newPosition.x, newPosition.y, newPosition.z};
+
+    if (!m_propTransforms.Write(handle.GetIndex(), xyz, SharedTransformBuffer::POSITION_OFFSET, SharedTransformBuffer::POSITION_FLOATS))
+    {
+        DebuggerPrintf("警告：moveProp 的 slot %u 超出共用變換緩衝區容量 %u\n", handle.GetIndex(), m_propTransforms.GetSlotCapacity());
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// 控制代碼在套用時才釋放，同一幀內不會被新的方塊重複使用
+//----------------------------------------------------------------------------------------------------
+bool Game::RemoveProp(sEntityHandle const handle)
+{
+    if (!m_propHandles.IsValid(handle))
+    {
+        DebuggerPrintf("警告：JavaScript 請求移除無效的物件控制代碼 0x%08X\n", handle.m_value);
+        return false;
+    }
+
+    if (!m_scriptCommands.PushRemoveProp(handle))
+    {
+        DebuggerPrintf("警告：本幀的腳本指令已達上限，捨棄 removeProp 0x%08X\n", handle.m_value);
+        return false;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// transforms 為連續 slot 的完整變換（每個 slot SharedTransformBuffer::FLOATS_PER_SLOT 個 float），
+// 一次呼叫即可更新大量道具；於下一次 Update 開頭套用
+//----------------------------------------------------------------------------------------------------
+bool Game::WritePropTransforms(int const firstSlot, std::span<float const> const transforms)
+{
+    if (firstSlot < 0 || !m_propTransforms.Write(static_cast<uint32_t>(firstSlot), transforms))
+    {
+        DebuggerPrintf("警告：writeTransforms 範圍無效（slot %d，%zu 個數值）\n", firstSlot, transforms.size());
+        return false;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// 只更新位置欄位（每個 slot 3 個 float），方向與顏色維持不變
+//----------------------------------------------------------------------------------------------------
+bool Game::WritePropPositions(int const firstSlot, std::span<float const> const positions)
+{
+    if (firstSlot < 0 || !m_propTransforms.Write(static_cast<uint32_t>(firstSlot), positions,
+                                                 SharedTransformBuffer::POSITION_OFFSET, SharedTransformBuffer::POSITION_FLOATS))
+    {
+        DebuggerPrintf("警告：writePositions 範圍無效（slot %d，%zu 個數值）\n", firstSlot, positions.size());
+        return false;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// 腳本直接寫入共用記憶體（ArrayBuffer）後呼叫，標記需要套用的 slot 範圍。
+// fieldMask 為 SharedTransformBuffer::FIELD_* 的組合（position 1、orientation 2、color 4），省略或 0 表示全部欄位
+//----------------------------------------------------------------------------------------------------
+bool Game::MarkPropTransformsDirty(int const firstSlot, int const slotCount, int const fieldMask)
+{
+    if (firstSlot < 0 || slotCount <= 0 || fieldMask < 0 || fieldMask > SharedTransformBuffer::FIELD_ALL)
+    {
+        return false;
+    }
+
+    uint8_t const mask = fieldMask == 0 ? SharedTransformBuffer::FIELD_ALL : static_cast<uint8_t>(fieldMask);
+
+    return m_propTransforms.MarkDirty(static_cast<uint32_t>(firstSlot), static_cast<uint32_t>(slotCount), mask);
+}
+
+//----------------------------------------------------------------------------------------------------
+// 只處理被腳本標記的 slot，且只更新寫入過的欄位。每幀呼叫兩次：
+//  - ApplyScriptCommands 之前（isBeforeScriptCommands）：套用到已存在的道具；
+//    本幀 createCube 保留、尚未建立的道具（PENDING_PROP_INDEX）保持 dirty，等建立後再套用
+//  - ApplyScriptCommands 之後：套用到剛建立的道具，仍無法對應的 slot 直接捨棄
+// 先套用到既有道具，removeProp 釋放的 slot 即使在同一次套用中被 createCubes 重複使用，也不會收到舊道具的寫入
+//----------------------------------------------------------------------------------------------------
+void Game::ApplyPropTransformBuffer(bool const isBeforeScriptCommands)
+{
+    PROFILE_SCOPE("Game::ApplyPropTransformBuffer");
+
+    m_propTransforms.ConsumeDirtySlots([this, isBeforeScriptCommands](uint32_t const     slot,
+                                                                      uint8_t const      fieldMask,
+                                                                      Vec3 const&        position,
+                                                                      EulerAngles const& orientation,
+                                                                      Rgba8 const&       color) {
+        uint32_t const* propIndexPtr = m_propHandles.ResolveSlot(slot);
+
+        if (!propIndexPtr)
+        {
+            return true;
+        }
+        if (*propIndexPtr == PENDING_PROP_INDEX)
+        {
+            return !isBeforeScriptCommands;
+        }
+
+        uint32_t const propIndex = *propIndexPtr;
+
+        if (fieldMask & SharedTransformBuffer::FIELD_ORIENTATION)
+        {
+            Vec3 const newPosition = (fieldMask & SharedTransformBuffer::FIELD_POSITION) ? position : m_props.GetPositions()[propIndex];
+            m_props.SetTransform(propIndex, newPosition, orientation);
+        }
+        else if (fieldMask & SharedTransformBuffer::FIELD_POSITION)
+        {
+            m_props.SetPosition(propIndex, position);
+        }
+
+        if (fieldMask & SharedTransformBuffer::FIELD_COLOR)
+        {
+            m_props.GetColors()[propIndex] = color;
+        }
+
+        if (fieldMask & SharedTransformBuffer::FIELD_POSITION)
+        {
+            UpdatePropCullBounds(propIndex);
+        }
+
+        return true;
+    });
+}
+
+//----------------------------------------------------------------------------------------------------
+// 每幀更新後寫回目前狀態，腳本讀取共用緩衝區時看到的是最新值
+//----------------------------------------------------------------------------------------------------
+void Game::SyncPropTransformBuffer()
+{
+    std::span<sEntityHandle const> const handles      = m_props.GetHandles();
+    std::span<Vec3 const> const          positions    = m_props.GetPositions();
+    std::span<EulerAngles const> const   orientations = m_props.GetOrientations();
+    std::span<Rgba8 const> const         colors       = m_props.GetColors();
+
+    for (size_t propIndex = 0; propIndex < handles.size(); ++propIndex)
+    {
+        if (!handles[propIndex].IsValid())
+        {
+            continue;
+        }
+
+        m_propTransforms.SetSlot(handles[propIndex].GetIndex(), positions[propIndex], orientations[propIndex], colors[propIndex]);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// 腳本對 m_props 的建立與移除：依入列順序套用（移動與變換由 ApplyPropTransformBuffer 套用）
+//----------------------------------------------------------------------------------------------------
+void Game::ApplyScriptCommands()
 {
-    DebuggerPrintf("JavaScript 請求建立方塊在位置 (%.2f, %.2f, %.2f)\n", position.x, position.y, position.z);
+    PROFILE_SCOPE("Game::ApplyScriptCommands");
 
-    // 建立新的方塊物件
-    Prop* newCube       = new Prop(this);
-    newCube->m_position = position;
-    newCube->m_color    = Rgba8(
-        static_cast<unsigned char>(g_theRNG->RollRandomIntInRange(100, 255)),
-        static_cast<unsigned char>(g_theRNG->RollRandomIntInRange(100, 255)),
-        static_cast<unsigned char>(g_theRNG->RollRandomIntInRange(100, 255)),
-        255
-    );
-    newCube->InitializeLocalVertsForCube();
+    if (m_scriptCommands.IsEmpty())
+    {
+        return;
+    }
+
+    size_t numCreated = 0;
+    size_t numRemoved = 0;
+
+    m_props.Reserve(m_props.GetCount() + m_scriptCommands.GetPendingCreateCount());
 
-    // 加入到物件清單
-    m_props.push_back(newCube);
+    m_scriptCommands.Consume(
+        [this, &numCreated](std::span<float const> const positions, std::span<Rgba8 const> const colors, std::span<sEntityHandle const> const reservedHandles) {
+            for (size_t cubeIndex = 0; cubeIndex < reservedHandles.size(); ++cubeIndex)
+            {
+                float const* xyz   = &positions[cubeIndex * 3];
+                Rgba8 const  color = cubeIndex < colors.size() ? colors[cubeIndex] : GetRandomCubeColor();
+
+                if (SpawnCube(Vec3(xyz[0], xyz[1], xyz[2]), color, reservedHandles[cubeIndex]))
+                {
+                    ++numCreated;
+                }
+            }
+        },
+        [this, &numRemoved](sEntityHandle const handle) {
+            DestroyProp(handle);
+            ++numRemoved;
+        });
 
-    DebuggerPrintf("方塊建立成功！目前共有 %zu 個物件\n", m_props.size());
+    if (numCreated > 0 || numRemoved > 0)
+    {
+        DebuggerPrintf("建立 %zu 個、移除 %zu 個方塊，目前共有 %zu 個物件\n", numCreated, numRemoved, m_props.GetCount());
+    }
 }
 
 //----------------------------------------------------------------------------------------------------
-void Game::MoveProp(int propIndex, Vec3 const& newPosition)
+// reservedHandle 有效時沿用（CreateCube 入列時保留的控制代碼），否則配置新的；控制代碼用完時不新增並回傳 false
+//----------------------------------------------------------------------------------------------------
+bool Game::AddProp(Vec3 const& position, Rgba8 const& color, uint32_t const meshId, sEntityHandle reservedHandle)
 {
-    if (propIndex >= 0 && propIndex < static_cast<int>(m_props.size()))
+    uint32_t const propIndex = static_cast<uint32_t>(m_props.GetCount());
+
+    if (uint32_t* reservedIndex = m_propHandles.Resolve(reservedHandle))
     {
-        m_props[propIndex]->m_position = newPosition;
-        DebuggerPrintf("物件 %d 移動到位置 (%.2f, %.2f, %.2f)\n", propIndex, newPosition.x, newPosition.y, newPosition.z);
+        *reservedIndex = propIndex;
     }
     else
     {
-        DebuggerPrintf("警告：JavaScript 請求移動無效的物件索引 %d（總共 %zu 個物件）\n", propIndex, m_props.size());
+        reservedHandle = m_propHandles.Allocate(propIndex);
+
+        if (!reservedHandle.IsValid())
+        {
+            DebuggerPrintf("警告：物件數量已達上限，無法新增物件\n");
+            return false;
+        }
     }
+
+    m_props.Add(reservedHandle, position, EulerAngles::ZERO, EulerAngles::ZERO, color, meshId);
+    m_props.SetCullProxyId(propIndex, m_propCullTree.CreateProxy(GetPropCullBounds(propIndex), propIndex));
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// 以最後一個物件填補被移除的位置，維持 m_props 連續
+//----------------------------------------------------------------------------------------------------
+void Game::DestroyProp(sEntityHandle const handle)
+{
+    uint32_t const* propIndexPtr = m_propHandles.Resolve(handle);
+
+    if (propIndexPtr && *propIndexPtr != PENDING_PROP_INDEX)
+    {
+        uint32_t const propIndex = *propIndexPtr;
+
+        m_propCullTree.DestroyProxy(m_props.GetCullProxyId(propIndex));
+
+        sEntityHandle const movedHandle = m_props.RemoveSwapBack(propIndex);
+
+        if (uint32_t* movedIndex = m_propHandles.Resolve(movedHandle))
+        {
+            *movedIndex = propIndex;
+            m_propCullTree.SetUserData(m_props.GetCullProxyId(propIndex), propIndex);
+        }
+    }
+
+    m_propHandles.Release(handle);
+}
+
+//----------------------------------------------------------------------------------------------------
+// 以 mesh 的包圍球半徑展開，與旋轉無關：只旋轉的道具不需要更新 m_propCullTree
+//----------------------------------------------------------------------------------------------------
+AABB3 Game::GetPropCullBounds(uint32_t const propIndex) const
+{
+    sMeshEntry const* mesh     = m_meshRegistry.GetMesh(m_props.GetMeshIds()[propIndex]);
+    float const       radius   = mesh ? mesh->m_boundingRadius : 0.f;
+    Vec3 const&       position = m_props.GetPositions()[propIndex];
+
+    return AABB3(position - Vec3(radius, radius, radius), position + Vec3(radius, radius, radius));
+}
+
+//----------------------------------------------------------------------------------------------------
+// 道具仍在放大的包圍盒內時樹不變，只有移出時才重新插入
+//----------------------------------------------------------------------------------------------------
+void Game::UpdatePropCullBounds(uint32_t const propIndex)
+{
+    m_propCullTree.MoveProxy(m_props.GetCullProxyId(propIndex), GetPropCullBounds(propIndex));
+}
+
+//----------------------------------------------------------------------------------------------------
+void Game::EnableScriptWorker(ScriptWorkerExecutor executor)
+{
+    DisableScriptWorker();
+
+    m_scriptWorker = std::make_unique<ScriptWorker>(sScriptWorkerConfig{}, std::move(executor));
+    ReserveScriptWorkerHandles();
+    m_scriptWorker->Start();
+
+    PublishScriptWorkerSnapshot();
+}
+
+//----------------------------------------------------------------------------------------------------
+// 停止後仍把工作執行緒已送出的指令轉入 m_scriptCommands，避免遺失；沒有用到的保留控制代碼歸還
+//----------------------------------------------------------------------------------------------------
+void Game::DisableScriptWorker()
+{
+    if (!m_scriptWorker)
+    {
+        return;
+    }
+
+    m_scriptWorker->Stop();
+    CommitScriptWorkerCommands();
+    m_scriptWorker->ReleaseReservedHandles([this](sEntityHandle const handle) { m_propHandles.Release(handle); });
+    m_scriptWorker.reset();
+}
+
+//----------------------------------------------------------------------------------------------------
+// 與 CreateCube 相同，先以 PENDING_PROP_INDEX 保留控制代碼，工作執行緒的 createCube 可立即回傳
+//----------------------------------------------------------------------------------------------------
+void Game::ReserveScriptWorkerHandles()
+{
+    m_scriptWorker->ReserveHandles([this]() { return m_propHandles.Allocate(PENDING_PROP_INDEX); });
+}
+
+//----------------------------------------------------------------------------------------------------
+// 工作執行緒送回的指令在主執行緒轉成一般的延遲指令，與主執行緒腳本走相同的套用路徑
+//----------------------------------------------------------------------------------------------------
+void Game::CommitScriptWorkerCommands()
+{
+    if (!m_scriptWorker)
+    {
+        return;
+    }
+
+    m_scriptWorker->DrainCommands([this](sScriptWorkerCommand const& command) {
+        std::span<Rgba8 const> const color = command.m_hasColor ? std::span<Rgba8 const>(&command.m_color, 1) : std::span<Rgba8 const>();
+
+        if (command.m_type == eScriptCommandType::CREATE_CUBES && command.m_handle.IsValid())
+        {
+            if (!m_scriptCommands.PushCreateCube(command.m_position, command.m_handle, color))
+            {
+                DebuggerPrintf("警告：本幀的腳本指令已達上限，捨棄工作執行緒的 createCube\n");
+                m_propHandles.Release(command.m_handle);
+            }
+        }
+        else if (command.m_type == eScriptCommandType::CREATE_CUBES)
+        {
+            float const xyz[3] = {command.m_position.x, command.m_position.y, command.m_position.z};
+            CreateCubes(xyz, color);
+        }
+        else if (command.m_type == eScriptCommandType::REMOVE_PROP)
+        {
+            RemoveProp(command.m_handle);
+        }
+        else
+        {
+            MoveProp(command.m_handle, command.m_position);
+        }
+    });
+
+    if (m_scriptWorker->IsRunning())
+    {
+        ReserveScriptWorkerHandles();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void Game::PublishScriptWorkerSnapshot() const
+{
+    if (!m_scriptWorker)
+    {
+        return;
+    }
+
+    sScriptStateSnapshot snapshot;
+    snapshot.m_frameIndex     = static_cast<uint64_t>(m_gameClock->GetFrameCount());
+    snapshot.m_gameSeconds    = m_gameClock->GetTotalSeconds();
+    snapshot.m_playerPosition = GetPlayerPosition();
+    snapshot.m_propCount      = static_cast<uint32_t>(m_props.GetCount() + m_scriptCommands.GetPendingCreateCount());
+
+    m_scriptWorker->PublishSnapshot(snapshot);
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -599,6 +1405,18 @@ Player* Game::GetPlayer()
     return m_player;
 }
 
+//----------------------------------------------------------------------------------------------------
+Vec3 Game::GetPlayerPosition() const
+{
+    return m_player ? m_player->m_position : Vec3::ZERO;
+}
+
+//----------------------------------------------------------------------------------------------------
+std::string Game::GetGameStateName() const
+{
+    return IsAttractMode() ? "attract" : "game";
+}
+
 //----------------------------------------------------------------------------------------------------
 void Game::HandleConsoleCommands()
 {
@@ -641,14 +1459,11 @@ void Game::RunJavaScriptTests()
     // 遊戲物件互動測試
     ExecuteJavaScriptCommand("console.log('取得玩家位置:', game.getPlayerPos());");
 
-    // 建立物件測試
-    ExecuteJavaScriptCommand("game.createCube(3, 0, 3); console.log('已建立測試方塊');");
+    // 建立物件測試（createCube 回傳控制代碼）
+    ExecuteJavaScriptCommand("var testCube = game.createCube(3, 0, 3); console.log('已建立測試方塊');");
 
-    // 移動物件測試（移動第一個物件）
-    if (!m_props.empty())
-    {
-        ExecuteJavaScriptCommand("game.moveProp(0, 2, 1, 2); console.log('已移動第一個物件');");
-    }
+    // 移動物件測試（以控制代碼移動剛建立的方塊）
+    ExecuteJavaScriptCommand("game.moveProp(testCube, 2, 1, 2); console.log('已移動測試方塊');");
 
     // 複雜腳本測試
     ExecuteJavaScriptCommand(R"(
@@ -6,8 +6,23 @@
 #include "Engine/Core/VertexUtils.hpp"
 #include "Engine/Core/Vertex_PCUTBN.hpp"
 #include "Engine/Resource/ResourceHandle.hpp"
+#include "Game/Framework/DynamicAabbTree.hpp"
+#include "Game/Framework/FixedTimestep.hpp"
+#include "Game/Framework/HandleTable.hpp"
+#include "Game/Framework/InstanceBatcher.hpp"
+#include "Game/Framework/MeshRegistry.hpp"
+#include "Game/Framework/OcclusionBuffer.hpp"
+#include "Game/Framework/RenderQueue.hpp"
+#include "Game/Framework/ScriptCommandBuffer.hpp"
+#include "Game/Framework/ScriptTaskScheduler.hpp"
+#include "Game/Framework/ScriptWorker.hpp"
+#include "Game/Framework/SharedTransformBuffer.hpp"
+#include "Game/PropStore.hpp"
+#include <memory>
+#include <span>
 #include <vector>
 #include <string>
+#include <utility>
 
 struct Vertex_PCUTBN;
 class ModelResource;
@@ -43,10 +58,34 @@ public:
     void ExecuteJavaScriptFile(const std::string& filename);
     void HandleJavaScriptCommands();
 
-    // 新增：JavaScript 回呼函數需要的遊戲功能
-    void    CreateCube(const Vec3& position);
-    void    MoveProp(int propIndex, const Vec3& newPosition);
-    Player* GetPlayer();
+    // 選用：在工作執行緒的獨立 isolate 執行腳本（預設關閉）。啟用後 ExecuteJavaScriptCommand 改送往工作執行緒
+    void EnableScriptWorker(ScriptWorkerExecutor executor);
+    void DisableScriptWorker();
+
+    // 閒置節流時暫停 JS 排程任務（直接執行的腳本指令不受影響）
+    void SetScriptSchedulerPaused(bool isPaused) { m_scriptScheduler.SetPaused(isPaused); }
+
+    // 由 Scheduler.js 呼叫：任務數改變時回報（為 0 時不進入 V8），以及單一步驟超出預算的任務
+    void SetScriptTaskCount(int taskCount) { m_scriptScheduler.SetPendingTaskCount(taskCount); }
+    void ReportScriptTaskOverBudget(std::string const& taskName, float stepMs) const { m_scriptScheduler.ReportOverBudget(taskName, stepMs); }
+
+    // 新增：JavaScript 回呼函數需要的遊戲功能（建立、移動、移除為延遲指令，於下一次 Update 套用）
+    sEntityHandle              CreateCube(const Vec3& position);
+    std::vector<sEntityHandle> CreateCubes(std::span<float const> positions, std::span<Rgba8 const> colors = {});
+    void                       MoveProp(sEntityHandle handle, const Vec3& newPosition);
+    bool                       RemoveProp(sEntityHandle handle);
+    bool                       WritePropTransforms(int firstSlot, std::span<float const> transforms);
+    bool                       WritePropPositions(int firstSlot, std::span<float const> positions);
+    bool                       MarkPropTransformsDirty(int firstSlot, int slotCount, int fieldMask = 0);
+    Player*                    GetPlayer();
+    Vec3                       GetPlayerPosition() const;
+    std::string                GetGameStateName() const;
+
+    // 道具變換共用緩衝區（以控制代碼的 slot 索引定址），供 V8Subsystem 包裝成 ArrayBuffer
+    SharedTransformBuffer& GetPropTransformBuffer() { return m_propTransforms; }
+
+    // 所有道具共用的 mesh（每種形狀只有一份常駐的 GPU 緩衝區）
+    MeshRegistry const& GetMeshRegistry() const { return m_meshRegistry; }
 
     // 新增：控制台命令處理
     void HandleConsoleCommands();
@@ -57,16 +96,36 @@ public:
 private:
     void UpdateFromKeyBoard();
     void UpdateFromController();
-    void UpdateEntities(float gameDeltaSeconds, float systemDeltaSeconds) const;
+    void UpdateEntities(float gameDeltaSeconds, float systemDeltaSeconds);
+    void StepSimulation(float stepSeconds);
+    void UpdatePropTransforms();
     void RenderAttractMode() const;
+    void RenderProfilerOverlay() const;
     void RenderEntities() const;
-
-    void SpawnPlayer();
-    void SpawnProp();
+    void RenderScriptProps() const;
+    void SubmitIfVisible(Prop* prop, Vec3 const& viewPosition, float alpha) const;
+    bool RasterizePropOccluders() const;
+    void CullPropsAndSelectLods() const;
+    void StorePropLodLevels();
+
+    void  SpawnPlayer();
+    void  SpawnProp();
+    bool  SpawnCube(Vec3 const& position, Rgba8 const& color, sEntityHandle reservedHandle = {});
+    Rgba8 GetRandomCubeColor() const;
+    bool  AddProp(Vec3 const& position, Rgba8 const& color, uint32_t meshId, sEntityHandle reservedHandle = {});
+    void  DestroyProp(sEntityHandle handle);
+    AABB3 GetPropCullBounds(uint32_t propIndex) const;
+    void  UpdatePropCullBounds(uint32_t propIndex);
 
     // 新增：JavaScript 測試和除錯
     void RunJavaScriptTests();
     void SetupJavaScriptBindings();
+    void ApplyScriptCommands();
+    void CommitScriptWorkerCommands();
+    void ReserveScriptWorkerHandles();
+    void PublishScriptWorkerSnapshot() const;
+    void ApplyPropTransformBuffer(bool isBeforeScriptCommands);
+    void SyncPropTransformBuffer();
 
     Camera*    m_screenCamera = nullptr;
     Player*    m_player       = nullptr;
@@ -77,8 +136,37 @@ private:
     Clock*     m_gameClock    = nullptr;
     eGameState m_gameState    = eGameState::ATTRACT;
 
+    FixedTimestep m_fixedTimestep;   // 玩家與道具的模擬以固定步長執行，繪製時內插
+
     // 新增：物件管理
-    std::vector<Prop*> m_props;  // 用於 JavaScript 管理的物件清單
+    MeshRegistry                  m_meshRegistry;                               // mesh ID -> 共用的頂點／索引緩衝區
+    uint32_t                      m_cubeMeshId = MeshRegistry::INVALID_MESH_ID; // 腳本方塊使用的 mesh
+    Shader*                       m_propShader = nullptr;                       // 腳本道具使用的 shader（只查詢一次）
+    PropStore                     m_props;                                      // 用於 JavaScript 管理的物件（SoA 連續存放，移除時與最後一個交換）
+    HandleTable<uint32_t>         m_propHandles;                                // 控制代碼 -> m_props 索引
+    DynamicAabbTree               m_propCullTree;                               // m_props 的包圍盒階層（使用者資料為 m_props 索引），視錐剔除用
+    SharedTransformBuffer         m_propTransforms;                             // 腳本可直接讀寫的道具變換（slot 索引定址）
+    ScriptCommandBuffer           m_scriptCommands;                             // 腳本修改 m_props 的延遲指令
+    ScriptTaskScheduler           m_scriptScheduler;                            // 每幀推進 JS 的 Scheduler 任務
+    std::unique_ptr<ScriptWorker> m_scriptWorker;                               // 非空時腳本在工作執行緒執行
+    uint32_t                      m_propTransformRebuildCount = 0;              // 本幀重建的道具矩陣數量（靜止的道具不重建）
+
+    // 繪製用的暫存狀態（每幀於 Render 重建）
+    mutable RenderQueue           m_renderQueue;
+    mutable InstanceBatcher       m_propBatcher;
+    mutable RendererBackend       m_propRenderBackend;
+    mutable int                   m_propDrawCount = 0;
+    mutable std::vector<uint32_t> m_visiblePropIndices;   // 通過視錐與遮擋剔除的 m_props 索引
+    mutable std::vector<uint32_t> m_occluderPropIndices;  // 本幀光柵化為遮擋物的 m_props 索引
+    mutable std::vector<uint8_t>  m_visiblePropLodLevels; // 與 m_visiblePropIndices 對應的 LOD 層級（剔除前含 OCCLUDED_LOD_LEVEL）
+    mutable OcclusionBuffer       m_occlusionBuffer;
+    mutable uint32_t              m_visibleCount  = 0;    // 通過／未通過視錐剔除的道具數（含固定場景與腳本道具）
+    mutable uint32_t              m_culledCount   = 0;
+    mutable uint32_t              m_occludedCount = 0;    // 在視錐內但被遮擋的腳本道具數
+    mutable uint32_t              m_lodLevelCounts[MAX_MESH_LOD_COUNT] = {};   // 本幀可見的道具在各 LOD 層級的數量
+
+    // 本幀可見的固定場景道具與選出的 LOD 層級，下一次 Update 由 StorePropLodLevels 寫回
+    mutable std::vector<std::pair<Prop*, uint8_t>> m_fixedPropLodLevels;
 
     // 新增：JavaScript 狀態
     bool m_hasInitializedJS = false;
@@ -13,13 +13,23 @@
 #include "Engine/Math/MathUtils.hpp"
 #include "Engine/Renderer/Camera.hpp"
 
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    // Shared by the camera projection and the culling frustum
+    float constexpr CAMERA_ASPECT      = 2.f;
+    float constexpr CAMERA_FOV_DEGREES = 60.f;
+    float constexpr CAMERA_NEAR        = 0.1f;
+    float constexpr CAMERA_FAR         = 100.f;
+}
+
 //----------------------------------------------------------------------------------------------------
 Player::Player(Game* owner)
     : Entity(owner)
 {
     m_worldCamera = new Camera();
 
-    m_worldCamera->SetPerspectiveGraphicView(2.f, 60.f, 0.1f, 100.f);
+    m_worldCamera->SetPerspectiveGraphicView(CAMERA_ASPECT, CAMERA_FOV_DEGREES, CAMERA_NEAR, CAMERA_FAR);
 
     m_worldCamera->SetNormalizedViewport(AABB2::ZERO_TO_ONE);
 
@@ -45,7 +55,21 @@ Player::~Player()
 }
 
 //----------------------------------------------------------------------------------------------------
-void Player::Update(float deltaSeconds)
+// Fixed-step integration of the velocities sampled by UpdateFromInput
+//----------------------------------------------------------------------------------------------------
+void Player::Update(float const deltaSeconds)
+{
+    m_position += m_velocity * deltaSeconds;
+
+    m_orientation.m_rollDegrees += m_angularVelocity.m_rollDegrees * deltaSeconds;
+    m_orientation.m_rollDegrees = GetClamped(m_orientation.m_rollDegrees, -45.f, 45.f);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Runs once per rendered frame, before the simulation steps: look is applied directly (mouse deltas are
+// per frame and must not be applied once per step), movement is stored as velocities for Update.
+//----------------------------------------------------------------------------------------------------
+void Player::UpdateFromInput()
 {
     XboxController const& controller = g_theInput->GetController(0);
 
@@ -55,6 +79,7 @@ void Player::Update(float deltaSeconds)
         {
             m_position    = Vec3::ZERO;
             m_orientation = EulerAngles::ZERO;
+            SavePreviousTransform();
         }
     }
 
@@ -76,9 +101,9 @@ void Player::Update(float deltaSeconds)
     if (g_theInput->IsKeyDown(KEYCODE_Z) || controller.IsButtonDown(XBOX_BUTTON_LSHOULDER)) m_velocity -= Vec3(0.f, 0.f, 1.f) * moveSpeed;
     if (g_theInput->IsKeyDown(KEYCODE_C) || controller.IsButtonDown(XBOX_BUTTON_RSHOULDER)) m_velocity += Vec3(0.f, 0.f, 1.f) * moveSpeed;
 
-    if (g_theInput->IsKeyDown(KEYCODE_SHIFT) || controller.IsButtonDown(XBOX_BUTTON_A)) deltaSeconds *= 10.f;
+    float const sprintScale = g_theInput->IsKeyDown(KEYCODE_SHIFT) || controller.IsButtonDown(XBOX_BUTTON_A) ? 10.f : 1.f;
 
-    m_position += m_velocity * deltaSeconds;
+    m_velocity = m_velocity * sprintScale;
 
     Vec2 const rightStickInput = controller.GetRightStick().GetPosition();
     m_orientation.m_yawDegrees -= rightStickInput.x * 0.125f;
@@ -106,10 +131,27 @@ void Player::Update(float deltaSeconds)
     if (g_theInput->IsKeyDown(KEYCODE_Q)) m_angularVelocity.m_rollDegrees = 90.f;
     if (g_theInput->IsKeyDown(KEYCODE_E)) m_angularVelocity.m_rollDegrees = -90.f;
 
-    m_orientation.m_rollDegrees += m_angularVelocity.m_rollDegrees * deltaSeconds;
-    m_orientation.m_rollDegrees = GetClamped(m_orientation.m_rollDegrees, -45.f, 45.f);
+    m_angularVelocity.m_rollDegrees *= sprintScale;
+}
 
-    m_worldCamera->SetPositionAndOrientation(m_position, m_orientation);
+//----------------------------------------------------------------------------------------------------
+// Position and roll come from the simulation and are interpolated; yaw and pitch were set this frame
+// by UpdateFromInput, so they are used as-is to keep mouse look free of interpolation lag.
+//----------------------------------------------------------------------------------------------------
+void Player::UpdateCamera(float const alpha)
+{
+    EulerAngles cameraOrientation = m_orientation;
+    cameraOrientation.m_rollDegrees = Interpolate(m_previousOrientation.m_rollDegrees, m_orientation.m_rollDegrees, alpha);
+
+    m_view.m_position    = GetInterpolatedPosition(alpha);
+    m_view.m_orientation = cameraOrientation;
+    m_view.m_aspect      = CAMERA_ASPECT;
+    m_view.m_fovDegrees  = CAMERA_FOV_DEGREES;
+    m_view.m_nearZ       = CAMERA_NEAR;
+    m_view.m_farZ        = CAMERA_FAR;
+
+    m_worldCamera->SetPositionAndOrientation(m_view.m_position, m_view.m_orientation);
+    m_viewFrustum = ViewFrustum::CreatePerspective(m_view);
 }
 
 //----------------------------------------------------------------------------------------------------
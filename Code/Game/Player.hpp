@@ -5,6 +5,7 @@
 //----------------------------------------------------------------------------------------------------
 #pragma once
 #include "Game/Entity.hpp"
+#include "Game/Framework/ViewFrustum.hpp"
 
 //----------------------------------------------------------------------------------------------------
 class Camera;
@@ -18,11 +19,18 @@ public:
 
     void Update(float deltaSeconds) override;
     void Render() const override;
+    void UpdateFromInput();
+    void UpdateCamera(float alpha);
     void UpdateFromKeyBoard();
     void UpdateFromController();
 
-    Camera* GetCamera() const;
+    Camera*                 GetCamera() const;
+    // Both match the camera as of the last UpdateCamera
+    sPerspectiveView const& GetView() const { return m_view; }
+    ViewFrustum const&      GetViewFrustum() const { return m_viewFrustum; }
 
 private:
-    Camera* m_worldCamera = nullptr;
+    Camera*          m_worldCamera = nullptr;
+    sPerspectiveView m_view;
+    ViewFrustum      m_viewFrustum;
 };
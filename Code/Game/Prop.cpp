@@ -6,18 +6,24 @@
 #include "Game/Prop.hpp"
 
 #include "Engine/Core/Clock.hpp"
+#include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Core/VertexUtils.hpp"
 #include "Engine/Math/AABB3.hpp"
 #include "Engine/Renderer/BitmapFont.hpp"
 #include "Engine/Renderer/Renderer.hpp"
 #include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/MeshRegistry.hpp"
+#include "Game/Framework/RenderQueue.hpp"
+#include "Game/Game.hpp"
 #include "ThirdParty/stb/stb_image.h"
+#include <algorithm>
 
 //----------------------------------------------------------------------------------------------------
 Prop::Prop(Game* owner, Texture const* texture)
     : Entity(owner),
-      m_texture(texture)
+      m_texture(texture),
+      m_shader(g_theRenderer->CreateOrGetShaderFromFile("Data/Shaders/Bloom", eVertexType::VERTEX_PCU))
 {
 }
 
@@ -38,12 +44,86 @@ void Prop::Render() const
     g_theRenderer->SetSamplerMode(eSamplerMode::POINT_CLAMP);
     g_theRenderer->SetDepthMode(eDepthMode::READ_WRITE_LESS_EQUAL);  //DISABLE
     g_theRenderer->BindTexture(m_texture);
-    g_theRenderer->BindShader(g_theRenderer->CreateOrGetShaderFromFile("Data/Shaders/Bloom",eVertexType::VERTEX_PCU));
+    g_theRenderer->BindShader(m_shader);
+
+    DrawGeometry(m_lodLevel);
+}
+
+//----------------------------------------------------------------------------------------------------
+// 與 Render 相同的繪製狀態，但由 RenderQueue 只在與前一次繪製不同時才套用
+//----------------------------------------------------------------------------------------------------
+void Prop::SubmitToRenderQueue(RenderQueue& queue, Vec3 const& viewPosition, float const interpolationAlpha, uint8_t const lodLevel) const
+{
+    sRenderState state;
+    state.m_blendMode      = eBlendMode::OPAQUE;
+    state.m_rasterizerMode = eRasterizerMode::SOLID_CULL_BACK;
+    state.m_samplerMode    = eSamplerMode::POINT_CLAMP;
+    state.m_depthMode      = eDepthMode::READ_WRITE_LESS_EQUAL;
+    state.m_shader         = m_shader;
+    state.m_texture        = m_texture;
+
+    queue.Submit(eRenderPass::WORLD_OPAQUE, state, (m_position - viewPosition).GetLength(), [this, interpolationAlpha, lodLevel] {
+        g_theRenderer->SetModelConstants(GetInterpolatedModelToWorldTransform(interpolationAlpha), m_color);
+        DrawGeometry(lodLevel);
+    });
+}
+
+//----------------------------------------------------------------------------------------------------
+AABB3 Prop::GetWorldBounds() const
+{
+    float radius = 0.f;
+
+    if (sMeshEntry const* mesh = m_game->GetMeshRegistry().GetMesh(m_meshId))
+    {
+        radius = mesh->m_boundingRadius;
+    }
+    else
+    {
+        for (Vertex_PCU const& vertex : m_vertexes)
+        {
+            radius = std::max(radius, vertex.m_position.GetLength());
+        }
+    }
+
+    return AABB3(m_position - Vec3(radius, radius, radius), m_position + Vec3(radius, radius, radius));
+}
+
+//----------------------------------------------------------------------------------------------------
+uint8_t Prop::SelectLod(Vec3 const& viewPosition, float const tanHalfVerticalFov) const
+{
+    sMeshEntry const* mesh = m_game->GetMeshRegistry().GetMesh(m_meshId);
+
+    if (!mesh || mesh->m_lodChain.m_levelCount <= 1)
+    {
+        return m_lodLevel;
+    }
+
+    float const screenSize = GetProjectedScreenSize(mesh->m_boundingRadius, (m_position - viewPosition).GetLength(), tanHalfVerticalFov);
+
+    return mesh->m_lodChain.SelectLevel(screenSize, m_lodLevel);
+}
+
+//----------------------------------------------------------------------------------------------------
+void Prop::DrawGeometry(uint8_t const lodLevel) const
+{
+    if (m_meshId != MeshRegistry::INVALID_MESH_ID)
+    {
+        MeshRegistry const& meshRegistry = m_game->GetMeshRegistry();
+        meshRegistry.Draw(meshRegistry.GetLodMeshId(m_meshId, lodLevel));
+        return;
+    }
+
     g_theRenderer->DrawVertexArray(static_cast<int>(m_vertexes.size()), m_vertexes.data());
 }
 
 //----------------------------------------------------------------------------------------------------
 void Prop::InitializeLocalVertsForCube()
+{
+    AddVertsForCube(m_vertexes);
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC void Prop::AddVertsForCube(std::vector<Vertex_PCU>& verts)
 {
     Vec3 const frontBottomLeft(0.5f, -0.5f, -0.5f);
     Vec3 const frontBottomRight(0.5f, 0.5f, -0.5f);
@@ -54,28 +134,38 @@ void Prop::InitializeLocalVertsForCube()
     Vec3 const backTopLeft(-0.5f, 0.5f, 0.5f);
     Vec3 const backTopRight(-0.5f, -0.5f, 0.5f);
 
-    AddVertsForQuad3D(m_vertexes, frontBottomLeft, frontBottomRight, frontTopLeft, frontTopRight, Rgba8::RED);          // +X Red
-    AddVertsForQuad3D(m_vertexes, backBottomLeft, backBottomRight, backTopLeft, backTopRight, Rgba8::CYAN);             // -X -Red (Cyan)
-    AddVertsForQuad3D(m_vertexes, frontBottomRight, backBottomLeft, frontTopRight, backTopLeft, Rgba8::GREEN);          // -Y -Green (Magenta)
-    AddVertsForQuad3D(m_vertexes, backBottomRight, frontBottomLeft, backTopRight, frontTopLeft, Rgba8::MAGENTA);        // +Y Green
-    AddVertsForQuad3D(m_vertexes, frontTopLeft, frontTopRight, backTopRight, backTopLeft, Rgba8::BLUE);                 // +Z Blue
-    AddVertsForQuad3D(m_vertexes, backBottomRight, backBottomLeft, frontBottomLeft, frontBottomRight, Rgba8::YELLOW);   // -Z -Blue (Yellow)
+    AddVertsForQuad3D(verts, frontBottomLeft, frontBottomRight, frontTopLeft, frontTopRight, Rgba8::RED);          // +X Red
+    AddVertsForQuad3D(verts, backBottomLeft, backBottomRight, backTopLeft, backTopRight, Rgba8::CYAN);             // -X -Red (Cyan)
+    AddVertsForQuad3D(verts, frontBottomRight, backBottomLeft, frontTopRight, backTopLeft, Rgba8::GREEN);          // -Y -Green (Magenta)
+    AddVertsForQuad3D(verts, backBottomRight, frontBottomLeft, backTopRight, frontTopLeft, Rgba8::MAGENTA);        // +Y Green
+    AddVertsForQuad3D(verts, frontTopLeft, frontTopRight, backTopRight, backTopLeft, Rgba8::BLUE);                 // +Z Blue
+    AddVertsForQuad3D(verts, backBottomRight, backBottomLeft, frontBottomLeft, frontBottomRight, Rgba8::YELLOW);   // -Z -Blue (Yellow)
 }
 
 //----------------------------------------------------------------------------------------------------
 void Prop::InitializeLocalVertsForSphere()
 {
-    float constexpr radius    = 0.5f;
-    int constexpr   numSlices = 32;
-    int constexpr   numStacks = 16;
-    Rgba8 const     color     = Rgba8::WHITE;
-    AABB2 const     UVs       = AABB2::ZERO_TO_ONE;
+    AddVertsForSphere(m_vertexes, m_position);
+}
 
-    AddVertsForSphere3D(m_vertexes, m_position, radius, color, UVs, numSlices, numStacks);
+//----------------------------------------------------------------------------------------------------
+STATIC void Prop::AddVertsForSphere(std::vector<Vertex_PCU>& verts, Vec3 const& center, int const numSlices, int const numStacks)
+{
+    float constexpr radius = 0.5f;
+    Rgba8 const     color  = Rgba8::WHITE;
+    AABB2 const     UVs    = AABB2::ZERO_TO_ONE;
+
+    AddVertsForSphere3D(verts, center, radius, color, UVs, numSlices, numStacks);
 }
 
 //----------------------------------------------------------------------------------------------------
 void Prop::InitializeLocalVertsForGrid()
+{
+    AddVertsForGrid(m_vertexes);
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC void Prop::AddVertsForGrid(std::vector<Vertex_PCU>& verts)
 {
     float gridLineLength = 100.f;
 
@@ -96,8 +186,8 @@ void Prop::InitializeLocalVertsForGrid()
             colorY = Rgba8::GREEN;
         }
 
-        AddVertsForAABB3D(m_vertexes, boundsX, colorX);
-        AddVertsForAABB3D(m_vertexes, boundsY, colorY);
+        AddVertsForAABB3D(verts, boundsX, colorX);
+        AddVertsForAABB3D(verts, boundsY, colorY);
     }
 }
 
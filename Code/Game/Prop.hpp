@@ -12,6 +12,9 @@
 #include "Game/Entity.hpp"
 
 //----------------------------------------------------------------------------------------------------
+class RenderQueue;
+class Shader;
+struct AABB3;
 class Texture;
 struct Vertex_PCU;
 
@@ -23,6 +26,7 @@ public:
 
     void Update(float deltaSeconds) override;
     void Render() const override;
+    void SubmitToRenderQueue(RenderQueue& queue, Vec3 const& viewPosition, float interpolationAlpha, uint8_t lodLevel) const;
     void InitializeLocalVertsForCube();
     void InitializeLocalVertsForSphere();
     void InitializeLocalVertsForGrid();
@@ -30,7 +34,27 @@ public:
     void InitializeLocalVertsForWorldCoordinateArrows();
     void InitializeLocalVertsForText2D();
 
+    void SetMesh(uint32_t meshId) { m_meshId = meshId; }
+
+    // 依投影大小選擇共用 mesh 的 LOD 層級（以目前層級做遲滯）並回傳，不修改道具；沒有 LOD 鏈時回傳目前層級。
+    // 選出的層級在繪製之後才以 SetLodLevel 寫回（Game::StorePropLodLevels）
+    uint8_t SelectLod(Vec3 const& viewPosition, float tanHalfVerticalFov) const;
+    uint8_t GetLodLevel() const { return m_lodLevel; }
+    void    SetLodLevel(uint8_t lodLevel) { m_lodLevel = lodLevel; }
+
+    // 不隨旋轉改變的世界包圍盒（包住 mesh 包圍球的立方體），旋轉時不需要更新
+    AABB3 GetWorldBounds() const;
+
+    static void AddVertsForCube(std::vector<Vertex_PCU>& verts);
+    static void AddVertsForSphere(std::vector<Vertex_PCU>& verts, Vec3 const& center = Vec3::ZERO, int numSlices = 32, int numStacks = 16);
+    static void AddVertsForGrid(std::vector<Vertex_PCU>& verts);
+
 private:
+    void DrawGeometry(uint8_t lodLevel) const;
+
     std::vector<Vertex_PCU> m_vertexes;
-    Texture const* m_texture = nullptr;
+    Texture const* m_texture  = nullptr;
+    Shader*        m_shader   = nullptr;      // 建構時查詢一次，不在每次繪製時查詢
+    uint32_t       m_meshId   = UINT32_MAX;   // MeshRegistry ID；設定後繪製共用 mesh 而不是 m_vertexes
+    uint8_t        m_lodLevel = 0;            // 上一次繪製選出的 LOD 層級，SelectLod 以它做遲滯
 };
@@ -0,0 +1,251 @@
+//----------------------------------------------------------------------------------------------------
+// PropStore.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/PropStore.hpp"
+
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Game/Framework/TransformBatch.hpp"
+#include <algorithm>
+
+//----------------------------------------------------------------------------------------------------
+static_assert(sizeof(EulerAngles) == 3 * sizeof(float), "IntegrateAngularVelocities treats EulerAngles arrays as packed floats");
+
+//----------------------------------------------------------------------------------------------------
+uint32_t PropStore::Add(sEntityHandle const handle,
+                        Vec3 const&         position,
+                        EulerAngles const&  orientation,
+                        EulerAngles const&  angularVelocity,
+                        Rgba8 const&        color,
+                        uint32_t const      meshId)
+{
+    uint32_t const index = static_cast<uint32_t>(m_positions.size());
+
+    m_positions.push_back(position);
+    m_orientations.push_back(orientation);
+    m_previousOrientations.push_back(orientation);
+    m_angularVelocities.push_back(angularVelocity);
+    m_colors.push_back(color);
+    m_meshIds.push_back(meshId);
+    m_handles.push_back(handle);
+    m_modelToWorlds.push_back(GetModelToWorldTransform(index));
+    m_isTransformDirty.push_back(0);
+    m_cullProxyIds.push_back(-1);
+    m_lodLevels.push_back(0);
+
+    return index;
+}
+
+//----------------------------------------------------------------------------------------------------
+// 回傳被搬進 index 的道具控制代碼；index 是最後一個道具時回傳無效的控制代碼
+//----------------------------------------------------------------------------------------------------
+sEntityHandle PropStore::RemoveSwapBack(uint32_t const index)
+{
+    if (index >= m_positions.size())
+    {
+        return {};
+    }
+
+    size_t const  lastIndex = m_positions.size() - 1;
+    sEntityHandle movedHandle;
+
+    if (index != lastIndex)
+    {
+        m_positions[index]            = m_positions[lastIndex];
+        m_orientations[index]         = m_orientations[lastIndex];
+        m_previousOrientations[index] = m_previousOrientations[lastIndex];
+        m_angularVelocities[index]    = m_angularVelocities[lastIndex];
+        m_colors[index]               = m_colors[lastIndex];
+        m_meshIds[index]              = m_meshIds[lastIndex];
+        m_handles[index]              = m_handles[lastIndex];
+        m_modelToWorlds[index]        = m_modelToWorlds[lastIndex];
+        m_isTransformDirty[index]     = m_isTransformDirty[lastIndex];
+        m_cullProxyIds[index]         = m_cullProxyIds[lastIndex];
+        m_lodLevels[index]            = m_lodLevels[lastIndex];
+        movedHandle                   = m_handles[index];
+    }
+
+    m_positions.pop_back();
+    m_orientations.pop_back();
+    m_previousOrientations.pop_back();
+    m_angularVelocities.pop_back();
+    m_colors.pop_back();
+    m_meshIds.pop_back();
+    m_handles.pop_back();
+    m_modelToWorlds.pop_back();
+    m_isTransformDirty.pop_back();
+    m_cullProxyIds.pop_back();
+    m_lodLevels.pop_back();
+
+    return movedHandle;
+}
+
+//----------------------------------------------------------------------------------------------------
+void PropStore::Reserve(size_t const count)
+{
+    m_positions.reserve(count);
+    m_orientations.reserve(count);
+    m_previousOrientations.reserve(count);
+    m_angularVelocities.reserve(count);
+    m_colors.reserve(count);
+    m_meshIds.reserve(count);
+    m_handles.reserve(count);
+    m_modelToWorlds.reserve(count);
+    m_isTransformDirty.reserve(count);
+    m_cullProxyIds.reserve(count);
+    m_lodLevels.reserve(count);
+}
+
+//----------------------------------------------------------------------------------------------------
+void PropStore::Clear()
+{
+    m_positions.clear();
+    m_orientations.clear();
+    m_previousOrientations.clear();
+    m_angularVelocities.clear();
+    m_colors.clear();
+    m_meshIds.clear();
+    m_handles.clear();
+    m_modelToWorlds.clear();
+    m_isTransformDirty.clear();
+    m_cullProxyIds.clear();
+    m_lodLevels.clear();
+}
+
+//----------------------------------------------------------------------------------------------------
+// 與 Prop::Update 相同的積分，對所有道具的 yaw/pitch/roll 做一次平坦的乘加，讓編譯器可以向量化
+//----------------------------------------------------------------------------------------------------
+void PropStore::IntegrateAngularVelocities(float const deltaSeconds)
+{
+    IntegrateAngularVelocities(deltaSeconds, 0, static_cast<uint32_t>(m_orientations.size()));
+}
+
+//----------------------------------------------------------------------------------------------------
+void PropStore::IntegrateAngularVelocities(float const deltaSeconds, uint32_t const begin, uint32_t const end)
+{
+    size_t const numFloats       = static_cast<size_t>(end - begin) * 3;
+    float*       orientations    = reinterpret_cast<float*>(m_orientations.data() + begin);
+    float const* angularVelocity = reinterpret_cast<float const*>(m_angularVelocities.data() + begin);
+
+    for (size_t floatIndex = 0; floatIndex < numFloats; ++floatIndex)
+    {
+        orientations[floatIndex] += angularVelocity[floatIndex] * deltaSeconds;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// 與 Entity::GetModelToWorldTransform 相同
+//----------------------------------------------------------------------------------------------------
+Mat44 PropStore::GetModelToWorldTransform(uint32_t const index) const
+{
+    EulerAngles const& orientation = m_orientations[index];
+    Mat44              m2w;
+
+    m2w.SetTranslation3D(m_positions[index]);
+
+    m2w.AppendZRotation(orientation.m_yawDegrees);
+    m2w.AppendYRotation(orientation.m_pitchDegrees);
+    m2w.AppendXRotation(orientation.m_rollDegrees);
+
+    return m2w;
+}
+
+//----------------------------------------------------------------------------------------------------
+void PropStore::SavePreviousOrientations()
+{
+    SavePreviousOrientations(0, static_cast<uint32_t>(m_orientations.size()));
+}
+
+//----------------------------------------------------------------------------------------------------
+void PropStore::SavePreviousOrientations(uint32_t const begin, uint32_t const end)
+{
+    std::copy(m_orientations.begin() + begin, m_orientations.begin() + end, m_previousOrientations.begin() + begin);
+}
+
+//----------------------------------------------------------------------------------------------------
+// 直接寫入方向後呼叫，避免道具從舊的方向內插過去
+//----------------------------------------------------------------------------------------------------
+void PropStore::SnapPreviousOrientation(uint32_t const index)
+{
+    m_previousOrientations[index] = m_orientations[index];
+}
+
+//----------------------------------------------------------------------------------------------------
+void PropStore::SetPosition(uint32_t const index, Vec3 const& position)
+{
+    m_positions[index]        = position;
+    m_isTransformDirty[index] = 1;
+}
+
+//----------------------------------------------------------------------------------------------------
+void PropStore::SetTransform(uint32_t const index, Vec3 const& position, EulerAngles const& orientation)
+{
+    m_positions[index]            = position;
+    m_orientations[index]         = orientation;
+    m_previousOrientations[index] = orientation;
+    m_isTransformDirty[index]     = 1;
+}
+
+//----------------------------------------------------------------------------------------------------
+// 上一步方向有改變的道具會繪製在兩個方向之間，矩陣取決於 alpha：每幀都重建，並保持 dirty
+// 直到某一步方向不再改變，之後以確切的方向最後重建一次再清除旗標
+//----------------------------------------------------------------------------------------------------
+uint32_t PropStore::UpdateModelToWorldTransforms(float const alpha, uint32_t const begin, uint32_t const end)
+{
+    sTransformBatch4 batch;
+    Mat44*           targets[4]   = {};
+    int              laneCount    = 0;
+    uint32_t         rebuiltCount = 0;
+
+    for (uint32_t index = begin; index < end; ++index)
+    {
+        EulerAngles const& previous       = m_previousOrientations[index];
+        EulerAngles const& current        = m_orientations[index];
+        bool const         isInterpolated = !AreOrientationsEqual(previous, current);
+
+        if (!m_isTransformDirty[index] && !isInterpolated)
+        {
+            continue;
+        }
+
+        m_isTransformDirty[index] = isInterpolated ? 1 : 0;
+
+        EulerAngles const orientation(Interpolate(previous.m_yawDegrees, current.m_yawDegrees, alpha),
+                                      Interpolate(previous.m_pitchDegrees, current.m_pitchDegrees, alpha),
+                                      Interpolate(previous.m_rollDegrees, current.m_rollDegrees, alpha));
+
+        batch.SetLane(laneCount, m_positions[index], orientation);
+        targets[laneCount] = &m_modelToWorlds[index];
+        ++laneCount;
+        ++rebuiltCount;
+
+        if (laneCount == 4)
+        {
+            BuildModelToWorldTransforms4(batch, targets);
+            laneCount = 0;
+        }
+    }
+
+    // 不滿四個的批次以 lane 0 補齊，結果寫入暫存矩陣
+    if (laneCount > 0)
+    {
+        Mat44 scratch;
+
+        for (int lane = laneCount; lane < 4; ++lane)
+        {
+            batch.m_positionX[lane]    = batch.m_positionX[0];
+            batch.m_positionY[lane]    = batch.m_positionY[0];
+            batch.m_positionZ[lane]    = batch.m_positionZ[0];
+            batch.m_yawDegrees[lane]   = batch.m_yawDegrees[0];
+            batch.m_pitchDegrees[lane] = batch.m_pitchDegrees[0];
+            batch.m_rollDegrees[lane]  = batch.m_rollDegrees[0];
+            targets[lane]              = &scratch;
+        }
+
+        BuildModelToWorldTransforms4(batch, targets);
+    }
+
+    return rebuiltCount;
+}
@@ -0,0 +1,82 @@
+//----------------------------------------------------------------------------------------------------
+// PropStore.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Math/EulerAngles.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Math/Vec3.hpp"
+#include "Game/Framework/EntityHandle.hpp"
+#include <cstdint>
+#include <span>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+// 腳本道具的 SoA（structure-of-arrays）存放：每一欄都以相同的連續道具索引存取，
+// 移除時把最後一個道具搬進空位，讓各欄保持連續。
+// 道具沒有虛擬函式表，也沒有自己的頂點資料，幾何以 mesh ID 共用。
+//
+// 每個道具快取一個 model-to-world 矩陣。位置與方向只能透過 setter 寫入，寫入時標記快取為 dirty；
+// UpdateModelToWorldTransforms 只以每次四個的方式重建 dirty 的道具（以及兩步之間仍在旋轉的道具），
+// 靜止的道具每幀不花任何成本。
+//----------------------------------------------------------------------------------------------------
+class PropStore
+{
+public:
+    uint32_t      Add(sEntityHandle handle, Vec3 const& position, EulerAngles const& orientation, EulerAngles const& angularVelocity, Rgba8 const& color, uint32_t meshId);
+    sEntityHandle RemoveSwapBack(uint32_t index);
+    void          Reserve(size_t count);
+    void          Clear();
+
+    // [begin, end) 版本只存取該索引範圍，不重疊的範圍可以在不同執行緒執行
+    void  IntegrateAngularVelocities(float deltaSeconds);
+    void  IntegrateAngularVelocities(float deltaSeconds, uint32_t begin, uint32_t end);
+    Mat44 GetModelToWorldTransform(uint32_t index) const;
+
+    // 每步只積分方向；位置由腳本直接瞬移，不做內插
+    void  SavePreviousOrientations();
+    void  SavePreviousOrientations(uint32_t begin, uint32_t end);
+    void  SnapPreviousOrientation(uint32_t index);
+
+    void SetPosition(uint32_t index, Vec3 const& position);
+    void SetTransform(uint32_t index, Vec3 const& position, EulerAngles const& orientation);   // 同時重設前一步的方向
+
+    // 以內插係數 alpha 重建 [begin, end) 內的快取矩陣，回傳重建的數量
+    uint32_t     UpdateModelToWorldTransforms(float alpha, uint32_t begin, uint32_t end);
+    Mat44 const& GetCachedModelToWorldTransform(uint32_t index) const { return m_modelToWorlds[index]; }
+
+    // 道具在剔除樹中的 proxy ID；PropStore 只負責在交換移除時跟著搬移
+    int32_t GetCullProxyId(uint32_t index) const { return m_cullProxyIds[index]; }
+    void    SetCullProxyId(uint32_t index, int32_t proxyId) { m_cullProxyIds[index] = proxyId; }
+
+    // 上一幀為道具選擇的 LOD 層級，選擇時讀回做遲滯判斷。
+    // 每次呼叫只寫入自己的元素，不同索引可以在不同執行緒設定
+    uint8_t GetLodLevel(uint32_t index) const { return m_lodLevels[index]; }
+    void    SetLodLevel(uint32_t index, uint8_t lodLevel) { m_lodLevels[index] = lodLevel; }
+
+    size_t GetCount() const { return m_positions.size(); }
+    bool   IsEmpty() const { return m_positions.empty(); }
+
+    std::span<Vec3 const>          GetPositions() const { return m_positions; }
+    std::span<EulerAngles const>   GetOrientations() const { return m_orientations; }
+    std::span<EulerAngles>         GetAngularVelocities() { return m_angularVelocities; }
+    std::span<Rgba8>               GetColors() { return m_colors; }
+    std::span<Rgba8 const>         GetColors() const { return m_colors; }
+    std::span<uint32_t const>      GetMeshIds() const { return m_meshIds; }
+    std::span<sEntityHandle const> GetHandles() const { return m_handles; }
+
+private:
+    std::vector<Vec3>          m_positions;
+    std::vector<EulerAngles>   m_orientations;
+    std::vector<EulerAngles>   m_previousOrientations;
+    std::vector<EulerAngles>   m_angularVelocities;
+    std::vector<Rgba8>         m_colors;
+    std::vector<uint32_t>      m_meshIds;
+    std::vector<sEntityHandle> m_handles;
+    std::vector<Mat44>         m_modelToWorlds;
+    std::vector<uint8_t>       m_isTransformDirty;
+    std::vector<int32_t>       m_cullProxyIds;
+    std::vector<uint8_t>       m_lodLevels;
+};
@@ -8,6 +8,7 @@
 #include "Engine/Renderer/Light.hpp"
 #include "Engine/Renderer/RenderCommon.hpp"
 #include "Engine/Renderer/Renderer.hpp"
+#include "Game/Framework/FrameProfiler.hpp"
 #include "Game/Framework/GameCommon.hpp"
 
 //------------------------------------------------------------------------------------------------
@@ -54,6 +55,8 @@ void LightSubsystem::StartUp()
 
 void LightSubsystem::BeginFrame()
 {
+    PROFILE_SCOPE("LightSubsystem::BeginFrame");
+
     g_theRenderer->SetLightConstants(m_lights, GetLightCount());
 }
 
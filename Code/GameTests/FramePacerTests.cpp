@@ -0,0 +1,171 @@
+//----------------------------------------------------------------------------------------------------
+// FramePacerTests.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/FramePacer.hpp"
+#include "GameTests/GameTest.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    uint64_t constexpr START_TIME_NS = 1000000000;   // 0 是 FramePacer 的「尚未對齊」，從 1 秒開始
+    uint64_t constexpr MS_TO_NS      = 1000000;
+
+    //------------------------------------------------------------------------------------------------
+    // 每幀先花 workNs 的工作時間再等待；回傳最後一幀結束的時間
+    //------------------------------------------------------------------------------------------------
+    uint64_t RunFrames(ManualFrameClock& clock, FramePacer& pacer, int const frameCount, uint64_t const workNs)
+    {
+        for (int frameIndex = 0; frameIndex < frameCount; ++frameIndex)
+        {
+            clock.AdvanceNs(workNs);
+            pacer.WaitForNextFrame();
+        }
+
+        return clock.GetTimeNs();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// 截止時間以固定間隔累加：睡眠準確時每幀都剛好落在截止時間（誤差在一次自旋步長內），不會漂移
+//----------------------------------------------------------------------------------------------------
+GAME_TEST(FramePacer_HitsDeadlinesWithoutDrift)
+{
+    ManualFrameClock clock;
+    clock.m_timeNs = START_TIME_NS;
+
+    FramePacer pacer(clock, sFramePacerConfig{100.f, 0.002f, 240});
+
+    pacer.WaitForNextFrame();
+    uint64_t const firstFrameEndNs = clock.GetTimeNs();
+
+    uint64_t const lastFrameEndNs = RunFrames(clock, pacer, 50, 3 * MS_TO_NS);
+    uint64_t const expectedEndNs  = firstFrameEndNs + 50 * 10 * MS_TO_NS;
+
+    GAME_TEST_CHECK(lastFrameEndNs >= expectedEndNs);
+    GAME_TEST_CHECK(lastFrameEndNs < expectedEndNs + clock.m_spinStepNs);
+    GAME_TEST_CHECK(clock.m_sleepCount == 50);
+    GAME_TEST_CHECK(clock.m_spinCount == 50 * 2000);   // 每幀最後 2 ms 以 1 us 的步長自旋
+}
+
+//----------------------------------------------------------------------------------------------------
+// 睡過頭的時間被記下並擴大自旋視窗：只有第一次睡眠錯過截止時間，之後每幀都準時
+//----------------------------------------------------------------------------------------------------
+GAME_TEST(FramePacer_LearnsSleepOvershoot)
+{
+    ManualFrameClock clock;
+    clock.m_timeNs           = START_TIME_NS;
+    clock.m_sleepOvershootNs = 3 * MS_TO_NS / 2;
+    clock.m_spinStepNs       = 10000;
+
+    FramePacer pacer(clock, sFramePacerConfig{100.f, 0.0005f, 240});
+
+    pacer.WaitForNextFrame();
+    uint64_t const firstDeadlineNs = clock.GetTimeNs() + 10 * MS_TO_NS;
+
+    clock.AdvanceNs(2 * MS_TO_NS);
+    pacer.WaitForNextFrame();
+
+    GAME_TEST_CHECK(clock.GetTimeNs() == firstDeadlineNs + MS_TO_NS);
+
+    for (int frameIndex = 1; frameIndex <= 10; ++frameIndex)
+    {
+        uint64_t const deadlineNs = firstDeadlineNs + static_cast<uint64_t>(frameIndex) * 10 * MS_TO_NS;
+
+        clock.AdvanceNs(2 * MS_TO_NS);
+        pacer.WaitForNextFrame();
+
+        GAME_TEST_CHECK(clock.GetTimeNs() >= deadlineNs);
+        GAME_TEST_CHECK(clock.GetTimeNs() < deadlineNs + clock.m_spinStepNs);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// 落後超過一整幀時重新對齊到現在並記為錯過，之後不會連續不等待地追趕
+//----------------------------------------------------------------------------------------------------
+GAME_TEST(FramePacer_RealignsAfterMissedDeadline)
+{
+    ManualFrameClock clock;
+    clock.m_timeNs = START_TIME_NS;
+
+    FramePacer pacer(clock, sFramePacerConfig{100.f, 0.002f, 3});
+
+    pacer.WaitForNextFrame();
+
+    clock.AdvanceNs(25 * MS_TO_NS);
+    pacer.WaitForNextFrame();
+
+    uint64_t const realignedNs = clock.GetTimeNs();
+    GAME_TEST_CHECK(clock.m_sleepCount == 0);
+
+    clock.AdvanceNs(MS_TO_NS);
+    pacer.WaitForNextFrame();
+
+    GAME_TEST_CHECK(clock.GetTimeNs() >= realignedNs + 10 * MS_TO_NS);
+    GAME_TEST_CHECK(clock.m_sleepCount == 1);
+
+    clock.AdvanceNs(MS_TO_NS);
+    pacer.WaitForNextFrame();
+
+    GAME_TEST_CHECK(pacer.GetLastStats().m_frameCount == 3);
+    GAME_TEST_CHECK(pacer.GetLastStats().m_missedDeadlines == 1);
+}
+
+//----------------------------------------------------------------------------------------------------
+// 可喚醒的睡眠遇到輸入就結束等待，並從喚醒時間重新對齊截止時間
+//----------------------------------------------------------------------------------------------------
+GAME_TEST(FramePacer_WakesOnInput)
+{
+    ManualFrameClock clock;
+    clock.m_timeNs = START_TIME_NS;
+
+    FramePacer pacer(clock, sFramePacerConfig{10.f, 0.002f, 240});
+    pacer.SetWakeOnInput(true);
+
+    pacer.WaitForNextFrame();
+
+    clock.AdvanceNs(MS_TO_NS);
+    clock.m_hasPendingInput = true;
+    pacer.WaitForNextFrame();
+
+    uint64_t const wokenAtNs = clock.GetTimeNs();
+
+    GAME_TEST_CHECK(pacer.WasWokenByInput());
+    GAME_TEST_CHECK(wokenAtNs == START_TIME_NS + MS_TO_NS);
+
+    clock.AdvanceNs(MS_TO_NS);
+    pacer.WaitForNextFrame();
+
+    GAME_TEST_CHECK(!pacer.WasWokenByInput());
+    GAME_TEST_CHECK(clock.GetTimeNs() >= wokenAtNs + 100 * MS_TO_NS);
+}
+
+//----------------------------------------------------------------------------------------------------
+// 不限制幀率時仍統計幀時間；百分位數取 0.25 ms 直方圖所在格的上緣
+//----------------------------------------------------------------------------------------------------
+GAME_TEST(FramePacer_PublishesFrameTimePercentiles)
+{
+    ManualFrameClock clock;
+    clock.m_timeNs = START_TIME_NS;
+
+    FramePacer pacer(clock, sFramePacerConfig{0.f, 0.002f, 4});
+
+    pacer.WaitForNextFrame();
+
+    for (uint64_t const frameMs : {1, 2, 3, 10})
+    {
+        clock.AdvanceNs(frameMs * MS_TO_NS);
+        pacer.WaitForNextFrame();
+    }
+
+    sFramePacerStats const& stats = pacer.GetLastStats();
+
+    GAME_TEST_CHECK(clock.m_sleepCount == 0 && clock.m_spinCount == 0);
+    GAME_TEST_CHECK(stats.m_frameCount == 4);
+    GAME_TEST_CHECK_NEAR(stats.m_averageMs, 4.f, 1e-4f);
+    GAME_TEST_CHECK_NEAR(stats.m_p50Ms, 2.25f, 1e-4f);
+    GAME_TEST_CHECK_NEAR(stats.m_p95Ms, 10.25f, 1e-4f);
+    GAME_TEST_CHECK_NEAR(stats.m_p99Ms, 10.25f, 1e-4f);
+    GAME_TEST_CHECK_NEAR(stats.m_maxMs, 10.f, 1e-4f);
+}
@@ -0,0 +1,50 @@
+//----------------------------------------------------------------------------------------------------
+// GameTest.hpp
+// 遊戲框架的無頭測試 - 不建立視窗、繪圖裝置或 V8，只測試純 C++ 的框架類別
+//----------------------------------------------------------------------------------------------------
+
+#pragma once
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+struct sGameTestCase
+{
+    char const* m_name           = nullptr;
+    void        (*m_function)()  = nullptr;
+};
+
+//----------------------------------------------------------------------------------------------------
+// 所有測試在靜態初始化時登記到這份清單；Main.cpp 依登記順序執行
+//----------------------------------------------------------------------------------------------------
+std::vector<sGameTestCase>& GetGameTestCases();
+int&                        GetGameTestFailureCount();
+
+//----------------------------------------------------------------------------------------------------
+struct sGameTestRegistrar
+{
+    sGameTestRegistrar(char const* name, void (*function)()) { GetGameTestCases().push_back({name, function}); }
+};
+
+//----------------------------------------------------------------------------------------------------
+// GAME_TEST(Name) { ... }：定義並登記一個測試
+// GAME_TEST_CHECK(condition)：失敗時印出位置並累計，不中斷目前的測試
+//----------------------------------------------------------------------------------------------------
+#define GAME_TEST(name)                                                                  \
+    static void               GameTest_##name();                                         \
+    static sGameTestRegistrar s_gameTestRegistrar_##name(#name, &GameTest_##name);       \
+    static void               GameTest_##name()
+
+#define GAME_TEST_CHECK(condition)                                                            \
+    do                                                                                        \
+    {                                                                                         \
+        if (!(condition))                                                                     \
+        {                                                                                     \
+            std::printf("  %s(%d): check failed: %s\n", __FILE__, __LINE__, #condition);     \
+            ++GetGameTestFailureCount();                                                      \
+        }                                                                                     \
+    } while (false)
+
+#define GAME_TEST_CHECK_NEAR(actual, expected, tolerance) \
+    GAME_TEST_CHECK(std::fabs(static_cast<double>(actual) - static_cast<double>(expected)) <= static_cast<double>(tolerance))
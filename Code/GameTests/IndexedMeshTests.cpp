@@ -0,0 +1,146 @@
+//----------------------------------------------------------------------------------------------------
+// IndexedMeshTests.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/VertexUtils.hpp"
+#include "Game/Framework/IndexedMesh.hpp"
+#include "Game/Framework/MeshRegistry.hpp"
+#include "GameTests/GameTest.hpp"
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    bool IsSameBytes(std::vector<Vertex_PCU> const& a, std::vector<Vertex_PCU> const& b)
+    {
+        return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size() * sizeof(Vertex_PCU)) == 0;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // 最佳化會重排三角形但不改變三角形內的頂點順序：以每個三角形的位元組排序後比較
+    //------------------------------------------------------------------------------------------------
+    std::vector<std::string> GetSortedTriangleBytes(std::vector<Vertex_PCU> const& triangles)
+    {
+        std::vector<std::string> triangleBytes;
+
+        for (size_t firstVertex = 0; firstVertex + 2 < triangles.size(); firstVertex += 3)
+        {
+            triangleBytes.emplace_back(reinterpret_cast<char const*>(&triangles[firstVertex]), sizeof(Vertex_PCU) * 3);
+        }
+
+        std::sort(triangleBytes.begin(), triangleBytes.end());
+
+        return triangleBytes;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    std::vector<Vertex_PCU> MakeGridTriangles()
+    {
+        std::vector<Vertex_PCU> triangles;
+
+        for (int x = -5; x <= 5; ++x)
+        {
+            AddVertsForAABB3D(triangles, AABB3(Vec3(static_cast<float>(x), -5.f, 0.f), Vec3(static_cast<float>(x) + 0.1f, 5.f, 0.1f)), Rgba8::DARK_GREY);
+        }
+
+        AddVertsForSphere3D(triangles, Vec3(0.f, 0.f, 2.f), 1.f, Rgba8::WHITE, AABB2::ZERO_TO_ONE, 32, 16);
+
+        return triangles;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// 合併後展開與原本的三角形列表逐位元組相同，且頂點確實減少
+//----------------------------------------------------------------------------------------------------
+GAME_TEST(IndexedMesh_WeldedMeshExpandsBitExact)
+{
+    std::vector<Vertex_PCU> const triangles = MakeGridTriangles();
+
+    sIndexedMesh mesh;
+    AppendWeldedTriangles(mesh, triangles);
+
+    std::vector<Vertex_PCU> expanded;
+    ExpandIndexedMesh(mesh, expanded);
+
+    GAME_TEST_CHECK(IsSameBytes(expanded, triangles));
+    GAME_TEST_CHECK(mesh.m_indexes.size() == triangles.size());
+    GAME_TEST_CHECK(mesh.m_vertexes.size() < triangles.size() / 2);
+}
+
+//----------------------------------------------------------------------------------------------------
+// 頂點快取與讀取最佳化後，三角形集合（含繞向）不變，ACMR 不變差
+//----------------------------------------------------------------------------------------------------
+GAME_TEST(IndexedMesh_OptimizedMeshKeepsTriangles)
+{
+    std::vector<Vertex_PCU> const triangles = MakeGridTriangles();
+
+    sIndexedMesh mesh;
+    AppendWeldedTriangles(mesh, triangles);
+
+    float const acmrBefore = GetAverageCacheMissRatio(mesh.m_indexes, mesh.m_vertexes.size());
+
+    OptimizeVertexCache(mesh.m_indexes, mesh.m_vertexes.size());
+    OptimizeVertexFetch(mesh);
+
+    float const acmrAfter = GetAverageCacheMissRatio(mesh.m_indexes, mesh.m_vertexes.size());
+
+    std::vector<Vertex_PCU> expanded;
+    ExpandIndexedMesh(mesh, expanded);
+
+    GAME_TEST_CHECK(GetSortedTriangleBytes(expanded) == GetSortedTriangleBytes(triangles));
+    GAME_TEST_CHECK(acmrAfter <= acmrBefore);
+    GAME_TEST_CHECK(acmrAfter < 1.f);
+}
+
+//----------------------------------------------------------------------------------------------------
+// MeshRegistry 對頂點數不超過 UINT16_MAX 的 mesh 只保留 16 位元索引，依索引展開的結果與原本的三角形相同
+//----------------------------------------------------------------------------------------------------
+GAME_TEST(MeshRegistry_StoresShortIndexesForSmallMeshes)
+{
+    std::vector<Vertex_PCU> const triangles = MakeGridTriangles();
+
+    sIndexedMesh mesh;
+    AppendWeldedTriangles(mesh, triangles);
+
+    MeshRegistry      meshRegistry;
+    sMeshEntry const* entry = meshRegistry.GetMesh(meshRegistry.RegisterMesh("Grid", mesh.m_vertexes, mesh.m_indexes));
+
+    GAME_TEST_CHECK(entry->IsIndexed());
+    GAME_TEST_CHECK(entry->m_indexCount == mesh.m_indexes.size());
+    GAME_TEST_CHECK(entry->m_shortIndexes.size() == mesh.m_indexes.size());
+    GAME_TEST_CHECK(entry->m_indexes.empty());
+
+    std::vector<Vertex_PCU> expanded;
+    entry->ForEachIndex([&expanded, entry](unsigned const index) { expanded.push_back(entry->m_vertexes[index]); });
+
+    GAME_TEST_CHECK(IsSameBytes(expanded, triangles));
+}
+
+//----------------------------------------------------------------------------------------------------
+// 頂點數超過 UINT16_MAX 時保留 32 位元索引
+//----------------------------------------------------------------------------------------------------
+GAME_TEST(MeshRegistry_KeepsWideIndexesForLargeMeshes)
+{
+    std::vector<Vertex_PCU> vertexes(UINT16_MAX + 2);
+    std::vector<unsigned>   indexes = {0, 1, UINT16_MAX + 1};
+
+    for (size_t vertexIndex = 0; vertexIndex < vertexes.size(); ++vertexIndex)
+    {
+        vertexes[vertexIndex].m_position = Vec3(static_cast<float>(vertexIndex), 0.f, 0.f);
+    }
+
+    MeshRegistry      meshRegistry;
+    sMeshEntry const* entry = meshRegistry.GetMesh(meshRegistry.RegisterMesh("Large", vertexes, indexes));
+
+    GAME_TEST_CHECK(entry->m_indexCount == 3);
+    GAME_TEST_CHECK(entry->m_shortIndexes.empty());
+    GAME_TEST_CHECK(entry->m_indexes == indexes);
+
+    std::vector<uint16_t> shortIndexes = {7};
+    GAME_TEST_CHECK(!PackIndexesTo16Bit(indexes, shortIndexes));
+    GAME_TEST_CHECK(shortIndexes.size() == 1 && shortIndexes[0] == 7);
+}
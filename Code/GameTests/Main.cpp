@@ -0,0 +1,52 @@
+//----------------------------------------------------------------------------------------------------
+// Main.cpp
+// GameTests 進入點：執行所有 GAME_TEST，有任何檢查失敗時回傳非零值讓建置失敗
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "GameTests/GameTest.hpp"
+#include "Game/Framework/GameCommon.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// 測試不建立 Renderer；MeshRegistry 在 g_theRenderer 為 nullptr 時只保留 CPU 端資料
+//----------------------------------------------------------------------------------------------------
+Renderer* g_theRenderer = nullptr;
+
+//----------------------------------------------------------------------------------------------------
+std::vector<sGameTestCase>& GetGameTestCases()
+{
+    static std::vector<sGameTestCase> s_testCases;
+    return s_testCases;
+}
+
+//----------------------------------------------------------------------------------------------------
+int& GetGameTestFailureCount()
+{
+    static int s_failureCount = 0;
+    return s_failureCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+int main()
+{
+    int numFailedTests = 0;
+
+    for (sGameTestCase const& testCase : GetGameTestCases())
+    {
+        int const failuresBefore = GetGameTestFailureCount();
+
+        testCase.m_function();
+
+        bool const isPassed = GetGameTestFailureCount() == failuresBefore;
+        std::printf("[%s] %s\n", isPassed ? "PASS" : "FAIL", testCase.m_name);
+
+        if (!isPassed)
+        {
+            ++numFailedTests;
+        }
+    }
+
+    std::printf("%zu tests, %d failed\n", GetGameTestCases().size(), numFailedTests);
+
+    return numFailedTests == 0 ? 0 : 1;
+}
@@ -0,0 +1,162 @@
+//----------------------------------------------------------------------------------------------------
+// PackedVertexTests.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Engine/Core/VertexUtils.hpp"
+#include "Engine/Core/Vertex_PCU.hpp"
+#include "Engine/Core/Vertex_PCUTBN.hpp"
+#include "Engine/Math/AABB3.hpp"
+#include "Game/Framework/PackedVertex.hpp"
+#include "GameTests/GameTest.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    // 以黃金角螺旋取得大致均勻分布的單位向量，再加上座標軸與八面體摺線上的方向
+    //------------------------------------------------------------------------------------------------
+    std::vector<Vec3> MakeTestDirections()
+    {
+        std::vector<Vec3> directions = {
+            Vec3(1.f, 0.f, 0.f), Vec3(-1.f, 0.f, 0.f), Vec3(0.f, 1.f, 0.f), Vec3(0.f, -1.f, 0.f), Vec3(0.f, 0.f, 1.f), Vec3(0.f, 0.f, -1.f),
+            Vec3(1.f, 1.f, 0.f).GetNormalized(), Vec3(-1.f, 1.f, 0.f).GetNormalized(), Vec3(1.f, -1.f, -1.f).GetNormalized(), Vec3(-1.f, -1.f, -1.f).GetNormalized(),
+        };
+
+        int constexpr   SAMPLE_COUNT = 4096;
+        float constexpr GOLDEN_ANGLE = 2.39996323f;
+
+        for (int sampleIndex = 0; sampleIndex < SAMPLE_COUNT; ++sampleIndex)
+        {
+            float const z      = 1.f - 2.f * (static_cast<float>(sampleIndex) + 0.5f) / static_cast<float>(SAMPLE_COUNT);
+            float const radius = std::sqrt(1.f - z * z);
+            float const angle  = GOLDEN_ANGLE * static_cast<float>(sampleIndex);
+
+            directions.emplace_back(radius * std::cos(angle), radius * std::sin(angle), z);
+        }
+
+        return directions;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // 以 atan2 計算夾角（acos 在接近 1 時的 float 精度不足以量測小誤差）
+    //------------------------------------------------------------------------------------------------
+    float GetAngleDegrees(Vec3 const& a, Vec3 const& b)
+    {
+        return std::atan2(CrossProduct3D(a, b).GetLength(), DotProduct3D(a, b)) * 57.2957795f;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// 16 位元八面體編碼：任何方向解碼後的角度誤差都遠小於 0.01 度，座標軸精確還原
+//----------------------------------------------------------------------------------------------------
+GAME_TEST(PackedVertex_OctahedralRoundTrip)
+{
+    float maxErrorDegrees = 0.f;
+
+    for (Vec3 const& direction : MakeTestDirections())
+    {
+        int16_t encoded[2];
+        EncodeOctahedral(direction, encoded);
+
+        Vec3 const decoded = DecodeOctahedral(encoded);
+
+        GAME_TEST_CHECK_NEAR(decoded.GetLength(), 1.f, 1e-5f);
+        maxErrorDegrees = std::max(maxErrorDegrees, GetAngleDegrees(direction, decoded));
+    }
+
+    GAME_TEST_CHECK(maxErrorDegrees < 0.01f);
+
+    for (Vec3 const& axis : {Vec3(1.f, 0.f, 0.f), Vec3(0.f, -1.f, 0.f), Vec3(0.f, 0.f, 1.f), Vec3(0.f, 0.f, -1.f)})
+    {
+        int16_t encoded[2];
+        EncodeOctahedral(axis, encoded);
+
+        GAME_TEST_CHECK(DecodeOctahedral(encoded) == axis);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// 切線框架：法線與切線的誤差與單獨編碼相同，副切線由 cross(N, T) 與手性還原
+//----------------------------------------------------------------------------------------------------
+GAME_TEST(PackedVertex_TangentFrameRoundTrip)
+{
+    std::vector<Vertex_PCUTBN> vertexes;
+
+    for (float const handedness : {1.f, -1.f})
+    {
+        for (Vec3 const& normal : {Vec3(0.f, 0.f, 1.f), Vec3(0.f, 0.f, -1.f), Vec3(1.f, 2.f, -3.f).GetNormalized()})
+        {
+            Vec3 const reference = std::fabs(normal.x) < 0.9f ? Vec3(1.f, 0.f, 0.f) : Vec3(0.f, 1.f, 0.f);
+
+            Vertex_PCUTBN vertex;
+            vertex.m_position    = Vec3(1.f, 2.f, 3.f);
+            vertex.m_color       = Rgba8(10, 20, 30, 40);
+            vertex.m_uvTexCoords = Vec2(0.25f, 0.75f);
+            vertex.m_normal      = normal;
+            vertex.m_tangent     = CrossProduct3D(reference, normal).GetNormalized();
+            vertex.m_bitangent   = CrossProduct3D(normal, vertex.m_tangent) * handedness;
+            vertexes.push_back(vertex);
+        }
+    }
+
+    std::vector<sPackedVertex_PCUTBN> packed;
+    PackVertexes(vertexes, packed);
+
+    GAME_TEST_CHECK(packed.size() == vertexes.size());
+
+    for (size_t vertexIndex = 0; vertexIndex < packed.size(); ++vertexIndex)
+    {
+        Vertex_PCUTBN const& source   = vertexes[vertexIndex];
+        Vertex_PCUTBN const  unpacked = UnpackVertex(packed[vertexIndex]);
+
+        GAME_TEST_CHECK(unpacked.m_position == source.m_position);
+        GAME_TEST_CHECK(unpacked.m_uvTexCoords.x == 0.25f && unpacked.m_uvTexCoords.y == 0.75f);
+        GAME_TEST_CHECK(GetAngleDegrees(unpacked.m_normal, source.m_normal) < 0.01f);
+        GAME_TEST_CHECK(GetAngleDegrees(unpacked.m_tangent, source.m_tangent) < 0.02f);
+        GAME_TEST_CHECK(GetAngleDegrees(unpacked.m_bitangent, source.m_bitangent) < 0.05f);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+GAME_TEST(PackedVertex_HalfFloatRoundTrip)
+{
+    for (float const value : {0.f, -0.f, 1.f, -2.f, 0.5f, 0.333251953125f, 65504.f, 6.103515625e-05f, 5.9604644775390625e-08f})
+    {
+        GAME_TEST_CHECK(HalfToFloat(FloatToHalf(value)) == value);
+    }
+
+    GAME_TEST_CHECK(FloatToHalf(1.f) == 0x3C00);
+    GAME_TEST_CHECK(FloatToHalf(1.f + 1.f / 2048.f) == 0x3C00);       // 剛好在中間時捨入到偶數
+    GAME_TEST_CHECK(FloatToHalf(1.f + 3.f / 2048.f) == 0x3C02);
+    GAME_TEST_CHECK(FloatToHalf(70000.f) == 0x7C00);                 // 超出範圍變成無限大
+    GAME_TEST_CHECK(std::isnan(HalfToFloat(FloatToHalf(std::numeric_limits<float>::quiet_NaN()))));
+}
+
+//----------------------------------------------------------------------------------------------------
+// 方塊以量化格式登錄時，CPU 端副本解碼後與全精度頂點逐位元組相同（角落 ±0.5、UV 只有 0 與 1）
+//----------------------------------------------------------------------------------------------------
+GAME_TEST(PackedVertex_QuantizedCubeDecodesLikeFullCube)
+{
+    std::vector<Vertex_PCU> cube;
+    AddVertsForAABB3D(cube, AABB3(Vec3(-0.5f, -0.5f, -0.5f), Vec3(0.5f, 0.5f, 0.5f)));
+
+    std::vector<sQuantizedVertex_PCU> quantized;
+    sPositionQuantization const       quantization = QuantizeVertexes(cube, quantized);
+
+    GAME_TEST_CHECK(quantized.size() == cube.size());
+
+    bool isIdentical = quantized.size() == cube.size();
+
+    for (size_t vertexIndex = 0; isIdentical && vertexIndex < cube.size(); ++vertexIndex)
+    {
+        Vertex_PCU const decoded = UnpackVertex(quantized[vertexIndex], quantization);
+        isIdentical              = std::memcmp(&decoded, &cube[vertexIndex], sizeof(Vertex_PCU)) == 0;
+    }
+
+    GAME_TEST_CHECK(isIdentical);
+}
@@ -0,0 +1,104 @@
+//----------------------------------------------------------------------------------------------------
+// RenderBackendTests.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/InstanceBatcher.hpp"
+#include "Game/Framework/MeshRegistry.hpp"
+#include "Game/Framework/RenderBackend.hpp"
+#include "GameTests/GameTest.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    // 只用位址比較的假材質；陣列元素的位址遞增，排序結果固定
+    char s_fakeMaterials[4] = {};
+
+    Shader*        const SHADER_A  = reinterpret_cast<Shader*>(&s_fakeMaterials[0]);
+    Shader*        const SHADER_B  = reinterpret_cast<Shader*>(&s_fakeMaterials[1]);
+    Texture const* const TEXTURE_A = reinterpret_cast<Texture const*>(&s_fakeMaterials[2]);
+
+    uint32_t constexpr UNREGISTERED_MESH_ID = 99;
+
+    //------------------------------------------------------------------------------------------------
+    Mat44 MakeTranslation(Vec3 const& translation)
+    {
+        Mat44 transform;
+        transform.SetTranslation3D(translation);
+        return transform;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    std::vector<Vertex_PCU> MakeTriangle()
+    {
+        return {
+            Vertex_PCU(Vec3(0.f, 0.f, 0.f), Rgba8::WHITE, Vec2(0.f, 0.f)),
+            Vertex_PCU(Vec3(1.f, 0.f, 0.f), Rgba8::WHITE, Vec2(1.f, 0.f)),
+            Vertex_PCU(Vec3(0.f, 1.f, 0.f), Rgba8::WHITE, Vec2(0.f, 1.f)),
+        };
+    }
+
+    //------------------------------------------------------------------------------------------------
+    bool IsSameColor(Rgba8 const& a, Rgba8 const& b)
+    {
+        return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    bool IsDraw(sRecordedDraw const& draw, Shader const* shader, Texture const* texture, uint32_t const meshId, uint32_t const instanceCount)
+    {
+        return draw.m_shader == shader && draw.m_texture == texture && draw.m_meshId == meshId && draw.m_instanceCount == instanceCount;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// 小場景：兩種 mesh、兩個 shader、一張貼圖，加上一個未登錄的 mesh。
+// 批次依 (shader, 貼圖, mesh) 排序、超過單次上限時切開、未登錄的 mesh 略過，材質只在改變時綁定
+//----------------------------------------------------------------------------------------------------
+GAME_TEST(RecordingRenderBackend_RecordsBatchedDrawSequence)
+{
+    MeshRegistry meshRegistry;
+
+    uint32_t const cubeMeshId   = meshRegistry.RegisterMesh("Cube", MakeTriangle());
+    uint32_t const sphereMeshId = meshRegistry.RegisterMesh("Sphere", MakeTriangle(), {0, 1, 2});
+
+    InstanceBatcher batcher(sInstanceBatcherConfig{2});
+
+    batcher.AddInstance(sphereMeshId, SHADER_A, TEXTURE_A, MakeTranslation(Vec3(0.f, 0.f, 0.f)), Rgba8::WHITE);
+    batcher.AddInstance(cubeMeshId, SHADER_B, nullptr, MakeTranslation(Vec3(1.f, 0.f, 0.f)), Rgba8::WHITE);
+    batcher.AddInstance(cubeMeshId, SHADER_A, nullptr, MakeTranslation(Vec3(2.f, 0.f, 0.f)), Rgba8::RED);
+    batcher.AddInstance(UNREGISTERED_MESH_ID, SHADER_A, nullptr, MakeTranslation(Vec3(3.f, 0.f, 0.f)), Rgba8::WHITE);
+    batcher.AddInstance(cubeMeshId, SHADER_A, nullptr, MakeTranslation(Vec3(4.f, 0.f, 0.f)), Rgba8::GREEN);
+    batcher.AddInstance(sphereMeshId, SHADER_A, TEXTURE_A, MakeTranslation(Vec3(5.f, 0.f, 0.f)), Rgba8::WHITE);
+    batcher.AddInstance(cubeMeshId, SHADER_A, nullptr, MakeTranslation(Vec3(6.f, 0.f, 0.f)), Rgba8::BLUE);
+    batcher.Build();
+
+    RecordingRenderBackend backend;
+    int const              drawCount = batcher.Submit(backend, meshRegistry);
+
+    std::span<sRecordedDraw const> const draws = backend.GetDraws();
+
+    GAME_TEST_CHECK(drawCount == 4);
+    GAME_TEST_CHECK(draws.size() == 4);
+    GAME_TEST_CHECK(backend.GetMaterialBindCount() == 3);
+
+    if (draws.size() == 4)
+    {
+        GAME_TEST_CHECK(IsDraw(draws[0], SHADER_A, nullptr, cubeMeshId, 2));
+        GAME_TEST_CHECK(IsDraw(draws[1], SHADER_A, nullptr, cubeMeshId, 1));
+        GAME_TEST_CHECK(IsDraw(draws[2], SHADER_A, TEXTURE_A, sphereMeshId, 2));
+        GAME_TEST_CHECK(IsDraw(draws[3], SHADER_B, nullptr, cubeMeshId, 1));
+    }
+
+    // 同一批次內保持加入順序
+    std::span<sInstanceData const> const instances = batcher.GetInstances();
+
+    GAME_TEST_CHECK(instances.size() == 7);
+    GAME_TEST_CHECK(IsSameColor(instances[0].m_tint, Rgba8::RED));
+    GAME_TEST_CHECK(IsSameColor(instances[1].m_tint, Rgba8::GREEN));
+    GAME_TEST_CHECK(IsSameColor(instances[2].m_tint, Rgba8::BLUE));
+
+    backend.Clear();
+    GAME_TEST_CHECK(backend.GetDrawCount() == 0);
+    GAME_TEST_CHECK(backend.GetMaterialBindCount() == 0);
+}
@@ -0,0 +1,78 @@
+//----------------------------------------------------------------------------------------------------
+// ScriptBindingTests.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/ScriptBinding.hpp"
+#include "Game/Framework/ScriptCommandBuffer.hpp"
+#include "GameTests/GameTest.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// 顏色陣列的位元組數必須是 4 的倍數，否則整個參數視為錯誤，不默默捨棄尾端
+//----------------------------------------------------------------------------------------------------
+GAME_TEST(ScriptBinding_RejectsPartialColorBytes)
+{
+    using ColorTraits = ScriptArgTraits<std::span<Rgba8 const>>;
+
+    std::vector<std::any> const args = {std::vector<uint8_t>{255, 0, 0, 255, 0, 255, 0, 255}, std::vector<uint8_t>{255, 0, 0, 255, 0, 255}};
+
+    size_t                 offset = 0;
+    std::span<Rgba8 const> colors;
+    ColorTraits::Storage   storage;
+
+    GAME_TEST_CHECK(ColorTraits::Convert(args, offset, colors, storage));
+    GAME_TEST_CHECK(offset == 1 && colors.size() == 2);
+    GAME_TEST_CHECK(colors[1].r == 0 && colors[1].g == 255);
+
+    GAME_TEST_CHECK(!ColorTraits::Convert(args, offset, colors, storage));
+    GAME_TEST_CHECK(offset == 1);
+}
+
+//----------------------------------------------------------------------------------------------------
+// createCubes 的控制代碼以 uint32_t 陣列回傳給腳本
+//----------------------------------------------------------------------------------------------------
+GAME_TEST(ScriptBinding_ReturnsHandleArray)
+{
+    std::vector<sEntityHandle> const handles = {sEntityHandle::Make(3, 1), sEntityHandle::Make(7, 2)};
+    std::any const                   result  = ScriptReturnTraits<std::vector<sEntityHandle>>::ToScript(handles);
+
+    std::vector<uint32_t> const* values = std::any_cast<std::vector<uint32_t>>(&result);
+
+    GAME_TEST_CHECK(values && values->size() == 2);
+    GAME_TEST_CHECK((*values)[0] == handles[0].m_value && (*values)[1] == handles[1].m_value);
+}
+
+//----------------------------------------------------------------------------------------------------
+// 批次建立的每個方塊在套用時都拿到入列時保留的控制代碼
+//----------------------------------------------------------------------------------------------------
+GAME_TEST(ScriptCommandBuffer_CreateCubesKeepsReservedHandles)
+{
+    ScriptCommandBuffer commands(4);
+
+    float const         positions[9] = {1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f};
+    sEntityHandle const handles[3]   = {sEntityHandle::Make(10, 1), sEntityHandle::Make(11, 1), sEntityHandle::Make(4, 3)};
+
+    GAME_TEST_CHECK(commands.PushCreateCube(Vec3(0.f, 0.f, 0.f), sEntityHandle::Make(1, 1)));
+    GAME_TEST_CHECK(commands.PushCreateCubes(positions, {}, handles));
+    GAME_TEST_CHECK(commands.GetPendingCreateCount() == 4);
+
+    std::vector<sEntityHandle> createdHandles;
+    std::vector<float>         createdX;
+
+    commands.Consume(
+        [&](std::span<float const> const cubePositions, std::span<Rgba8 const>, std::span<sEntityHandle const> const reservedHandles) {
+            GAME_TEST_CHECK(cubePositions.size() == reservedHandles.size() * 3);
+            for (size_t cubeIndex = 0; cubeIndex < reservedHandles.size(); ++cubeIndex)
+            {
+                createdHandles.push_back(reservedHandles[cubeIndex]);
+                createdX.push_back(cubePositions[cubeIndex * 3]);
+            }
+        },
+        [](sEntityHandle) {});
+
+    GAME_TEST_CHECK(createdHandles.size() == 4);
+    GAME_TEST_CHECK(createdHandles[0] == sEntityHandle::Make(1, 1));
+    GAME_TEST_CHECK(createdHandles[1] == handles[0] && createdHandles[2] == handles[1] && createdHandles[3] == handles[2]);
+    GAME_TEST_CHECK(createdX.size() == 4 && createdX[0] == 0.f && createdX[1] == 1.f && createdX[3] == 7.f);
+    GAME_TEST_CHECK(commands.IsEmpty());
+}
@@ -0,0 +1,121 @@
+//----------------------------------------------------------------------------------------------------
+// ScriptCommandBufferTests.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/ScriptCommandBuffer.hpp"
+#include "GameTests/GameTest.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    // 推入 cubeCount 個方塊，第 i 個方塊的 x 座標與控制代碼 slot 都是 firstValue + i
+    //------------------------------------------------------------------------------------------------
+    bool PushCubes(ScriptCommandBuffer& commands, uint32_t const firstValue, uint32_t const cubeCount)
+    {
+        std::vector<float>         positions;
+        std::vector<sEntityHandle> handles;
+
+        for (uint32_t cubeIndex = 0; cubeIndex < cubeCount; ++cubeIndex)
+        {
+            positions.insert(positions.end(), {static_cast<float>(firstValue + cubeIndex), 0.f, 0.f});
+            handles.push_back(sEntityHandle::Make(firstValue + cubeIndex, 1));
+        }
+
+        return commands.PushCreateCubes(positions, {}, handles);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // 套用全部指令，檢查每個方塊的座標與控制代碼仍然對應，回傳套用的方塊數
+    //------------------------------------------------------------------------------------------------
+    size_t ConsumeAndCheck(ScriptCommandBuffer& commands, bool& isConsistent)
+    {
+        size_t numCubes = 0;
+
+        commands.Consume(
+            [&](std::span<float const> const positions, std::span<Rgba8 const>, std::span<sEntityHandle const> const handles) {
+                for (size_t cubeIndex = 0; cubeIndex < handles.size(); ++cubeIndex)
+                {
+                    isConsistent = isConsistent && positions[cubeIndex * 3] == static_cast<float>(handles[cubeIndex].GetIndex());
+                    ++numCubes;
+                }
+            },
+            [](sEntityHandle) {});
+
+        return numCubes;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// 指令數達到容量後拒絕新的指令，不成長也不提前套用
+//----------------------------------------------------------------------------------------------------
+GAME_TEST(ScriptCommandBuffer_RejectsCommandsWhenFull)
+{
+    ScriptCommandBuffer commands(4, 64);
+
+    for (uint32_t slot = 1; slot <= 4; ++slot)
+    {
+        GAME_TEST_CHECK(commands.PushRemoveProp(sEntityHandle::Make(slot, 1)));
+    }
+
+    GAME_TEST_CHECK(!commands.PushRemoveProp(sEntityHandle::Make(5, 1)));
+    GAME_TEST_CHECK(!PushCubes(commands, 10, 1));
+    GAME_TEST_CHECK(commands.GetCount() == 4 && commands.GetCapacity() == 4);
+    GAME_TEST_CHECK(commands.GetPayloadUsed() == 0);
+
+    std::vector<uint32_t> removedSlots;
+    commands.Consume([](std::span<float const>, std::span<Rgba8 const>, std::span<sEntityHandle const>) {},
+                     [&](sEntityHandle const handle) { removedSlots.push_back(handle.GetIndex()); });
+
+    GAME_TEST_CHECK(removedSlots == std::vector<uint32_t>({1, 2, 3, 4}));
+    GAME_TEST_CHECK(commands.IsEmpty());
+}
+
+//----------------------------------------------------------------------------------------------------
+// payload 的方塊數有上限：放不下的批次整批拒絕，已入列的指令不受影響
+//----------------------------------------------------------------------------------------------------
+GAME_TEST(ScriptCommandBuffer_BoundsPayload)
+{
+    ScriptCommandBuffer commands(16, 10);
+
+    GAME_TEST_CHECK(commands.GetPayloadCapacity() * ScriptCommandBuffer::PAYLOAD_BYTES_PER_CUBE == 10 * 20);
+    GAME_TEST_CHECK(PushCubes(commands, 0, 6));
+    GAME_TEST_CHECK(!PushCubes(commands, 100, 5));
+    GAME_TEST_CHECK(!PushCubes(commands, 100, 11));
+    GAME_TEST_CHECK(PushCubes(commands, 6, 4));
+    GAME_TEST_CHECK(commands.GetPayloadUsed() == 10 && commands.GetPendingCreateCount() == 10);
+    GAME_TEST_CHECK(commands.GetCount() == 2);
+
+    bool isConsistent = true;
+    GAME_TEST_CHECK(ConsumeAndCheck(commands, isConsistent) == 10);
+    GAME_TEST_CHECK(isConsistent);
+    GAME_TEST_CHECK(commands.GetPayloadUsed() == 0 && commands.GetPendingCreateCount() == 0);
+}
+
+//----------------------------------------------------------------------------------------------------
+// 指令序號跨幀持續前進並在環中繞回；payload 在每幀套用後釋放
+//----------------------------------------------------------------------------------------------------
+GAME_TEST(ScriptCommandBuffer_WrapsAcrossFrames)
+{
+    ScriptCommandBuffer commands(4, 10);
+
+    bool   isConsistent = true;
+    size_t numCubes     = 0;
+
+    for (uint32_t frame = 0; frame < 50; ++frame)
+    {
+        uint32_t const firstValue = frame * 16;
+
+        GAME_TEST_CHECK(PushCubes(commands, firstValue, 3));
+        GAME_TEST_CHECK(PushCubes(commands, firstValue + 3, 4));
+        GAME_TEST_CHECK(commands.PushRemoveProp(sEntityHandle::Make(firstValue, 1)));
+
+        numCubes += ConsumeAndCheck(commands, isConsistent);
+
+        GAME_TEST_CHECK(commands.IsEmpty() && commands.GetPayloadUsed() == 0);
+    }
+
+    GAME_TEST_CHECK(isConsistent);
+    GAME_TEST_CHECK(numCubes == 50 * 7);
+}
@@ -0,0 +1,188 @@
+//----------------------------------------------------------------------------------------------------
+// ScriptWorkerTests.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/ScriptWorker.hpp"
+#include "GameTests/GameTest.hpp"
+#include <chrono>
+#include <mutex>
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    // 等待工作執行緒處理完 expectedCount 個腳本；逾時回傳 false
+    //------------------------------------------------------------------------------------------------
+    bool WaitForCount(std::atomic<int> const& count, int const expectedCount)
+    {
+        auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+        while (count.load(std::memory_order_acquire) < expectedCount)
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+            {
+                return false;
+            }
+
+            std::this_thread::yield();
+        }
+
+        return true;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// 快照不經過 inbox：大量快照之後仍可送出滿額的腳本，且腳本看到的是最後一份快照
+//----------------------------------------------------------------------------------------------------
+GAME_TEST(ScriptWorker_SnapshotsDoNotFillInbox)
+{
+    std::atomic<int>      numExecuted{0};
+    std::mutex            seenMutex;
+    std::vector<uint64_t> seenFrames;
+
+    sScriptWorkerConfig config;
+    config.m_inboxCapacity = 16;
+
+    ScriptWorker worker(config, [&](ScriptWorker& self, std::string const&) {
+        uint64_t const frameIndex = self.GetLatestSnapshot().m_frameIndex;
+        {
+            std::lock_guard<std::mutex> lock(seenMutex);
+            seenFrames.push_back(frameIndex);
+        }
+        numExecuted.fetch_add(1, std::memory_order_release);
+    });
+
+    for (uint64_t frameIndex = 1; frameIndex <= 1000; ++frameIndex)
+    {
+        sScriptStateSnapshot snapshot;
+        snapshot.m_frameIndex = frameIndex;
+        worker.PublishSnapshot(snapshot);
+    }
+
+    for (int scriptIndex = 0; scriptIndex < 16; ++scriptIndex)
+    {
+        GAME_TEST_CHECK(worker.SubmitScript("script"));
+    }
+
+    worker.Start();
+    GAME_TEST_CHECK(WaitForCount(numExecuted, 16));
+    worker.Stop();
+
+    std::lock_guard<std::mutex> lock(seenMutex);
+    GAME_TEST_CHECK(seenFrames.size() == 16);
+    for (uint64_t const frameIndex : seenFrames)
+    {
+        GAME_TEST_CHECK(frameIndex == 1000);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// 工作執行緒讀到的快照永遠是某一份完整發布的快照，frame 單調遞增
+//----------------------------------------------------------------------------------------------------
+GAME_TEST(ScriptWorker_SnapshotIsNeverTorn)
+{
+    std::atomic<bool> isTorn{false};
+    std::atomic<bool> isBackwards{false};
+    std::atomic<int>  numExecuted{0};
+
+    ScriptWorker worker(sScriptWorkerConfig{}, [&](ScriptWorker& self, std::string const&) {
+        uint64_t previousFrame = 0;
+
+        for (int readIndex = 0; readIndex < 20000; ++readIndex)
+        {
+            sScriptStateSnapshot const snapshot = self.GetLatestSnapshot();
+
+            if (snapshot.m_propCount != static_cast<uint32_t>(snapshot.m_frameIndex) ||
+                snapshot.m_gameSeconds != static_cast<double>(snapshot.m_frameIndex))
+            {
+                isTorn.store(true);
+            }
+            if (snapshot.m_frameIndex < previousFrame)
+            {
+                isBackwards.store(true);
+            }
+
+            previousFrame = snapshot.m_frameIndex;
+        }
+
+        numExecuted.fetch_add(1, std::memory_order_release);
+    });
+
+    worker.Start();
+    GAME_TEST_CHECK(worker.SubmitScript("reader"));
+
+    for (uint64_t frameIndex = 1; numExecuted.load(std::memory_order_acquire) == 0 && frameIndex < 10000000; ++frameIndex)
+    {
+        sScriptStateSnapshot snapshot;
+        snapshot.m_frameIndex  = frameIndex;
+        snapshot.m_gameSeconds = static_cast<double>(frameIndex);
+        snapshot.m_propCount   = static_cast<uint32_t>(frameIndex);
+        worker.PublishSnapshot(snapshot);
+    }
+
+    GAME_TEST_CHECK(WaitForCount(numExecuted, 1));
+    worker.Stop();
+
+    GAME_TEST_CHECK(!isTorn.load());
+    GAME_TEST_CHECK(!isBackwards.load());
+}
+
+//----------------------------------------------------------------------------------------------------
+// 工作執行緒的 createCube 立即取得主執行緒預先保留的控制代碼；Stop 後歸還沒用到的控制代碼
+//----------------------------------------------------------------------------------------------------
+GAME_TEST(ScriptWorker_CreatesUseReservedHandles)
+{
+    std::atomic<int>           numExecuted{0};
+    std::vector<sEntityHandle> handlesSeenByScript;
+
+    sScriptWorkerConfig config;
+    config.m_reservedHandleCapacity = 8;
+
+    ScriptWorker worker(config, [&](ScriptWorker& self, std::string const&) {
+        for (int cubeIndex = 0; cubeIndex < 3; ++cubeIndex)
+        {
+            sScriptWorkerCommand command;
+            command.m_type     = eScriptCommandType::CREATE_CUBES;
+            command.m_handle   = self.TakeReservedHandle();
+            command.m_position = Vec3(static_cast<float>(cubeIndex), 0.f, 0.f);
+
+            handlesSeenByScript.push_back(command.m_handle);
+            self.PushCommand(command);
+        }
+
+        numExecuted.fetch_add(1, std::memory_order_release);
+    });
+
+    // allocator 回傳無效的控制代碼（例如數量已達上限）時停止，之後的呼叫補滿剩下的部分
+    uint32_t nextHandleIndex = 1;
+    auto     allocateHandle  = [&]() { return sEntityHandle::Make(nextHandleIndex++, 1); };
+
+    GAME_TEST_CHECK(worker.ReserveHandles([&]() { return nextHandleIndex <= 5 ? allocateHandle() : sEntityHandle{}; }) == 5);
+    GAME_TEST_CHECK(worker.ReserveHandles(allocateHandle) == 3);
+
+    worker.Start();
+    GAME_TEST_CHECK(worker.SubmitScript("createCube x3"));
+    GAME_TEST_CHECK(WaitForCount(numExecuted, 1));
+
+    std::vector<sEntityHandle> committedHandles;
+    worker.DrainCommands([&](sScriptWorkerCommand const& command) {
+        GAME_TEST_CHECK(command.m_type == eScriptCommandType::CREATE_CUBES);
+        committedHandles.push_back(command.m_handle);
+    });
+
+    GAME_TEST_CHECK(committedHandles.size() == 3);
+    GAME_TEST_CHECK(committedHandles == handlesSeenByScript);
+    for (size_t handleIndex = 0; handleIndex < committedHandles.size(); ++handleIndex)
+    {
+        GAME_TEST_CHECK(committedHandles[handleIndex] == sEntityHandle::Make(static_cast<uint32_t>(handleIndex + 1), 1));
+    }
+
+    // 只補回用掉的數量
+    GAME_TEST_CHECK(worker.ReserveHandles(allocateHandle) == 3);
+
+    worker.Stop();
+
+    size_t const numReleased = worker.ReleaseReservedHandles([](sEntityHandle) {});
+    GAME_TEST_CHECK(numReleased == 8);
+}
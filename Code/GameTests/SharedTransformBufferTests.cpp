@@ -0,0 +1,155 @@
+//----------------------------------------------------------------------------------------------------
+// SharedTransformBufferTests.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/SharedTransformBuffer.hpp"
+#include "GameTests/GameTest.hpp"
+#include <limits>
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    struct sConsumedSlot
+    {
+        uint32_t    m_slot      = 0;
+        uint8_t     m_fieldMask = 0;
+        Vec3        m_position;
+        EulerAngles m_orientation;
+        Rgba8       m_color;
+    };
+
+    //------------------------------------------------------------------------------------------------
+    std::vector<sConsumedSlot> ConsumeAll(SharedTransformBuffer& buffer, uint32_t const deferredSlot = UINT32_MAX)
+    {
+        std::vector<sConsumedSlot> consumed;
+
+        buffer.ConsumeDirtySlots([&](uint32_t const slot, uint8_t const fieldMask, Vec3 const& position, EulerAngles const& orientation, Rgba8 const& color) {
+            if (slot == deferredSlot)
+            {
+                return false;
+            }
+
+            consumed.push_back({slot, fieldMask, position, orientation, color});
+            return true;
+        });
+
+        return consumed;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// writePositions 只標記位置欄位，方向與顏色不會被套用
+//----------------------------------------------------------------------------------------------------
+GAME_TEST(SharedTransformBuffer_PositionWriteMarksOnlyPosition)
+{
+    SharedTransformBuffer buffer(16);
+    buffer.SetSlot(3, Vec3(1.f, 2.f, 3.f), EulerAngles(10.f, 20.f, 30.f), Rgba8(40, 50, 60, 255));
+
+    float const positions[6] = {7.f, 8.f, 9.f, 4.f, 5.f, 6.f};
+    GAME_TEST_CHECK(buffer.Write(3, positions, SharedTransformBuffer::POSITION_OFFSET, SharedTransformBuffer::POSITION_FLOATS));
+
+    std::vector<sConsumedSlot> const consumed = ConsumeAll(buffer);
+
+    GAME_TEST_CHECK(consumed.size() == 2);
+    GAME_TEST_CHECK(consumed[0].m_slot == 3);
+    GAME_TEST_CHECK(consumed[0].m_fieldMask == SharedTransformBuffer::FIELD_POSITION);
+    GAME_TEST_CHECK(consumed[0].m_position == Vec3(7.f, 8.f, 9.f));
+    GAME_TEST_CHECK(consumed[1].m_slot == 4);
+    GAME_TEST_CHECK(consumed[1].m_fieldMask == SharedTransformBuffer::FIELD_POSITION);
+    GAME_TEST_CHECK(!buffer.HasDirtySlots());
+}
+
+//----------------------------------------------------------------------------------------------------
+// 同一個 slot 的多次寫入合併欄位遮罩，且只回報一次；最後寫入的值生效
+//----------------------------------------------------------------------------------------------------
+GAME_TEST(SharedTransformBuffer_WritesToSameSlotMerge)
+{
+    SharedTransformBuffer buffer(16);
+
+    float const firstPosition[3]  = {1.f, 1.f, 1.f};
+    float const secondPosition[3] = {2.f, 2.f, 2.f};
+    float const color[4]          = {255.f, 0.f, 0.f, 128.f};
+
+    buffer.Write(5, firstPosition, SharedTransformBuffer::POSITION_OFFSET, SharedTransformBuffer::POSITION_FLOATS);
+    buffer.Write(5, color, SharedTransformBuffer::COLOR_OFFSET, 4);
+    buffer.Write(5, secondPosition, SharedTransformBuffer::POSITION_OFFSET, SharedTransformBuffer::POSITION_FLOATS);
+
+    std::vector<sConsumedSlot> const consumed = ConsumeAll(buffer);
+
+    GAME_TEST_CHECK(consumed.size() == 1);
+    GAME_TEST_CHECK(consumed[0].m_fieldMask == (SharedTransformBuffer::FIELD_POSITION | SharedTransformBuffer::FIELD_COLOR));
+    GAME_TEST_CHECK(consumed[0].m_position == Vec3(2.f, 2.f, 2.f));
+    GAME_TEST_CHECK(consumed[0].m_color.r == 255 && consumed[0].m_color.g == 0 && consumed[0].m_color.a == 128);
+}
+
+//----------------------------------------------------------------------------------------------------
+// 回傳 false 的 slot 保持 dirty，下一次 ConsumeDirtySlots 仍帶著原本的欄位遮罩
+//----------------------------------------------------------------------------------------------------
+GAME_TEST(SharedTransformBuffer_DeferredSlotStaysDirty)
+{
+    SharedTransformBuffer buffer(16);
+
+    GAME_TEST_CHECK(buffer.MarkDirty(2, 3, SharedTransformBuffer::FIELD_ORIENTATION));
+
+    std::vector<sConsumedSlot> const firstPass = ConsumeAll(buffer, 3);
+    GAME_TEST_CHECK(firstPass.size() == 2);
+    GAME_TEST_CHECK(buffer.HasDirtySlots());
+
+    std::vector<sConsumedSlot> const secondPass = ConsumeAll(buffer);
+    GAME_TEST_CHECK(secondPass.size() == 1);
+    GAME_TEST_CHECK(secondPass[0].m_slot == 3);
+    GAME_TEST_CHECK(secondPass[0].m_fieldMask == SharedTransformBuffer::FIELD_ORIENTATION);
+    GAME_TEST_CHECK(!buffer.HasDirtySlots());
+}
+
+//----------------------------------------------------------------------------------------------------
+GAME_TEST(SharedTransformBuffer_RejectsOutOfRangeWrites)
+{
+    SharedTransformBuffer buffer(4);
+
+    float const transforms[SharedTransformBuffer::FLOATS_PER_SLOT * 2] = {};
+
+    GAME_TEST_CHECK(!buffer.Write(3, transforms));
+    GAME_TEST_CHECK(!buffer.MarkDirty(4, 1));
+    GAME_TEST_CHECK(!buffer.MarkDirty(0, 1, 0));
+    GAME_TEST_CHECK(!buffer.HasDirtySlots());
+    GAME_TEST_CHECK(SharedTransformBuffer::GetFieldMask(0, SharedTransformBuffer::FLOATS_PER_SLOT) == SharedTransformBuffer::FIELD_ALL);
+    GAME_TEST_CHECK(SharedTransformBuffer::GetFieldMask(4, 1) == SharedTransformBuffer::FIELD_ORIENTATION);
+}
+
+//----------------------------------------------------------------------------------------------------
+// 預設容量涵蓋控制代碼的所有 slot，slot 65536 以上的道具也能移動
+//----------------------------------------------------------------------------------------------------
+GAME_TEST(SharedTransformBuffer_DefaultCapacityCoversAllHandleSlots)
+{
+    SharedTransformBuffer buffer;
+
+    GAME_TEST_CHECK(buffer.GetSlotCapacity() == sEntityHandle::MAX_SLOT_COUNT);
+
+    float const position[3] = {1.f, 2.f, 3.f};
+    GAME_TEST_CHECK(buffer.Write(70000, position, SharedTransformBuffer::POSITION_OFFSET, SharedTransformBuffer::POSITION_FLOATS));
+    GAME_TEST_CHECK(buffer.Write(sEntityHandle::INDEX_MASK, position, SharedTransformBuffer::POSITION_OFFSET, SharedTransformBuffer::POSITION_FLOATS));
+
+    std::vector<sConsumedSlot> const consumed = ConsumeAll(buffer);
+
+    GAME_TEST_CHECK(consumed.size() == 2);
+    GAME_TEST_CHECK(consumed[0].m_slot == 70000 && consumed[1].m_slot == sEntityHandle::INDEX_MASK);
+}
+
+//----------------------------------------------------------------------------------------------------
+// 腳本寫入的 NaN 與無限大顏色視為 0，超出範圍的值夾在 0 - 255
+//----------------------------------------------------------------------------------------------------
+GAME_TEST(SharedTransformBuffer_ZeroesNonFiniteColors)
+{
+    SharedTransformBuffer buffer(4);
+
+    float const color[4] = {std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::infinity(), 300.f, -5.f};
+    GAME_TEST_CHECK(buffer.Write(1, color, SharedTransformBuffer::COLOR_OFFSET, 4));
+
+    std::vector<sConsumedSlot> const consumed = ConsumeAll(buffer);
+
+    GAME_TEST_CHECK(consumed.size() == 1);
+    GAME_TEST_CHECK(consumed[0].m_fieldMask == SharedTransformBuffer::FIELD_COLOR);
+    GAME_TEST_CHECK(consumed[0].m_color.r == 0 && consumed[0].m_color.g == 0 && consumed[0].m_color.b == 255 && consumed[0].m_color.a == 0);
+}
@@ -0,0 +1,152 @@
+//----------------------------------------------------------------------------------------------------
+// ViewFrustumTests.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/DynamicAabbTree.hpp"
+#include "Game/Framework/ViewFrustum.hpp"
+#include "GameTests/GameTest.hpp"
+#include <algorithm>
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    // 原點的相機朝 +X，垂直與水平視角都是 90 度：可見範圍為 |y| <= x、|z| <= x、0.1 <= x <= 100
+    //------------------------------------------------------------------------------------------------
+    ViewFrustum MakeTestFrustum()
+    {
+        sPerspectiveView view;
+        view.m_aspect     = 1.f;
+        view.m_fovDegrees = 90.f;
+        view.m_nearZ      = 0.1f;
+        view.m_farZ       = 100.f;
+
+        return ViewFrustum::CreatePerspective(view);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    AABB3 MakeBox(Vec3 const& center, float const halfSize)
+    {
+        return AABB3(center - Vec3(halfSize, halfSize, halfSize), center + Vec3(halfSize, halfSize, halfSize));
+    }
+
+    //------------------------------------------------------------------------------------------------
+    std::vector<uint32_t> QuerySorted(DynamicAabbTree const& tree, ViewFrustum const& frustum)
+    {
+        std::vector<uint32_t> visible;
+        tree.QueryFrustum(frustum, [&visible](uint32_t const userData) { visible.push_back(userData); });
+        std::sort(visible.begin(), visible.end());
+
+        return visible;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+GAME_TEST(ViewFrustum_ClassifiesKnownBoxes)
+{
+    ViewFrustum const frustum = MakeTestFrustum();
+
+    GAME_TEST_CHECK(frustum.TestAabb(MakeBox(Vec3(10.f, 0.f, 0.f), 1.f)) == eCullResult::INSIDE);
+    GAME_TEST_CHECK(frustum.TestAabb(MakeBox(Vec3(-10.f, 0.f, 0.f), 1.f)) == eCullResult::OUTSIDE);      // 相機後方
+    GAME_TEST_CHECK(frustum.TestAabb(MakeBox(Vec3(200.f, 0.f, 0.f), 1.f)) == eCullResult::OUTSIDE);      // 遠平面外
+    GAME_TEST_CHECK(frustum.TestAabb(MakeBox(Vec3(10.f, 20.f, 0.f), 1.f)) == eCullResult::OUTSIDE);      // 左側面外
+    GAME_TEST_CHECK(frustum.TestAabb(MakeBox(Vec3(10.f, 0.f, -20.f), 1.f)) == eCullResult::OUTSIDE);     // 下側面外
+    GAME_TEST_CHECK(frustum.TestAabb(MakeBox(Vec3(10.f, 10.f, 0.f), 1.f)) == eCullResult::INTERSECTING); // 跨過左側面
+    GAME_TEST_CHECK(frustum.TestAabb(MakeBox(Vec3(100.f, 0.f, 0.f), 1.f)) == eCullResult::INTERSECTING); // 跨過遠平面
+    GAME_TEST_CHECK(frustum.TestAabb(MakeBox(Vec3(0.f, 0.f, 0.f), 1.f)) == eCullResult::INTERSECTING);   // 包住相機
+
+    // 預設建構的視錐沒有平面，等同不剔除
+    GAME_TEST_CHECK(ViewFrustum().TestAabb(MakeBox(Vec3(-1000.f, 0.f, 0.f), 1.f)) == eCullResult::INSIDE);
+}
+
+//----------------------------------------------------------------------------------------------------
+// 旋轉後的相機：偏航 90 度後朝 +Y，原本可見的 +X 方塊變成不可見
+//----------------------------------------------------------------------------------------------------
+GAME_TEST(ViewFrustum_FollowsCameraOrientation)
+{
+    sPerspectiveView view;
+    view.m_position    = Vec3(0.f, 0.f, 5.f);
+    view.m_orientation = EulerAngles(90.f, 0.f, 0.f);
+    view.m_aspect      = 1.f;
+    view.m_fovDegrees  = 90.f;
+
+    ViewFrustum const frustum = ViewFrustum::CreatePerspective(view);
+
+    GAME_TEST_CHECK(frustum.TestAabb(MakeBox(Vec3(0.f, 10.f, 5.f), 1.f)) == eCullResult::INSIDE);
+    GAME_TEST_CHECK(frustum.TestAabb(MakeBox(Vec3(10.f, 0.f, 5.f), 1.f)) == eCullResult::OUTSIDE);
+}
+
+//----------------------------------------------------------------------------------------------------
+// 已知的一組方塊：樹的查詢結果與逐一測試相同，移動與移除後也保持一致
+//----------------------------------------------------------------------------------------------------
+GAME_TEST(DynamicAabbTree_QueryMatchesKnownVisibleSet)
+{
+    ViewFrustum const frustum = MakeTestFrustum();
+    DynamicAabbTree   tree(0.f);
+
+    std::vector<AABB3> const boxes = {
+        MakeBox(Vec3(10.f, 0.f, 0.f), 1.f),     // 0 在內
+        MakeBox(Vec3(-10.f, 0.f, 0.f), 1.f),    // 1 在後方
+        MakeBox(Vec3(10.f, 10.f, 0.f), 1.f),    // 2 跨過左側面
+        MakeBox(Vec3(10.f, 20.f, 0.f), 1.f),    // 3 在左側面外
+        MakeBox(Vec3(50.f, 0.f, 20.f), 1.f),    // 4 在內
+        MakeBox(Vec3(200.f, 0.f, 0.f), 1.f),    // 5 在遠平面外
+        MakeBox(Vec3(30.f, -25.f, 25.f), 1.f),  // 6 在內
+        MakeBox(Vec3(5.f, 0.f, -20.f), 1.f),    // 7 在下側面外
+    };
+
+    std::vector<int32_t> proxyIds;
+
+    for (size_t boxIndex = 0; boxIndex < boxes.size(); ++boxIndex)
+    {
+        proxyIds.push_back(tree.CreateProxy(boxes[boxIndex], static_cast<uint32_t>(boxIndex)));
+    }
+
+    GAME_TEST_CHECK(tree.Validate());
+    GAME_TEST_CHECK(QuerySorted(tree, frustum) == std::vector<uint32_t>({0, 2, 4, 6}));
+
+    // 3 移進視錐、0 移到相機後方、4 移除
+    GAME_TEST_CHECK(tree.MoveProxy(proxyIds[3], MakeBox(Vec3(20.f, 5.f, 0.f), 1.f)));
+    GAME_TEST_CHECK(tree.MoveProxy(proxyIds[0], MakeBox(Vec3(-20.f, 0.f, 0.f), 1.f)));
+    tree.DestroyProxy(proxyIds[4]);
+
+    GAME_TEST_CHECK(tree.Validate());
+    GAME_TEST_CHECK(tree.GetProxyCount() == 7);
+    GAME_TEST_CHECK(QuerySorted(tree, frustum) == std::vector<uint32_t>({2, 3, 6}));
+}
+
+//----------------------------------------------------------------------------------------------------
+// 規則排列的大量方塊：樹的結果等於以放大後的包圍盒逐一測試的結果，且樹保持平衡
+//----------------------------------------------------------------------------------------------------
+GAME_TEST(DynamicAabbTree_QueryMatchesBruteForceOnGrid)
+{
+    ViewFrustum const frustum = MakeTestFrustum();
+    DynamicAabbTree   tree(0.5f);
+
+    std::vector<int32_t> proxyIds;
+
+    for (int y = -20; y <= 20; ++y)
+    {
+        for (int x = -20; x <= 20; ++x)
+        {
+            uint32_t const userData = static_cast<uint32_t>(proxyIds.size());
+            proxyIds.push_back(tree.CreateProxy(MakeBox(Vec3(static_cast<float>(x) * 5.f, static_cast<float>(y) * 5.f, 0.f), 1.f), userData));
+        }
+    }
+
+    std::vector<uint32_t> expected;
+
+    for (size_t proxyIndex = 0; proxyIndex < proxyIds.size(); ++proxyIndex)
+    {
+        if (frustum.IsAabbVisible(tree.GetFatBounds(proxyIds[proxyIndex])))
+        {
+            expected.push_back(static_cast<uint32_t>(proxyIndex));
+        }
+    }
+
+    GAME_TEST_CHECK(tree.Validate());
+    GAME_TEST_CHECK(tree.GetHeight() <= 2 * 11);   // 1681 個葉節點，平衡樹高度約 log2(n)
+    GAME_TEST_CHECK(!expected.empty() && expected.size() < proxyIds.size());
+    GAME_TEST_CHECK(QuerySorted(tree, frustum) == expected);
+}
@@ -0,0 +1,48 @@
+// Prelude.js - Standard script library, evaluated once at startup before any game script runs
+
+var Prelude = Prelude || {};
+
+// Math helpers
+Prelude.lerp = function (a, b, t) {
+    return a + (b - a) * t;
+};
+
+Prelude.clamp = function (value, min, max) {
+    return value < min ? min : (value > max ? max : value);
+};
+
+Prelude.randomRange = function (min, max) {
+    return min + Math.random() * (max - min);
+};
+
+Prelude.distance3D = function (x1, y1, z1, x2, y2, z2) {
+    var dx = x2 - x1;
+    var dy = y2 - y1;
+    var dz = z2 - z1;
+    return Math.sqrt(dx * dx + dy * dy + dz * dz);
+};
+
+// Packs [{x, y, z}, ...] into the Float32Array layout expected by game.createCubes
+Prelude.packPositions = function (points) {
+    var positions = new Float32Array(points.length * 3);
+
+    for (var i = 0; i < points.length; i++) {
+        positions[i * 3 + 0] = points[i].x;
+        positions[i * 3 + 1] = points[i].y;
+        positions[i * 3 + 2] = points[i].z;
+    }
+
+    return positions;
+};
+
+// Prop handles: the low 20 bits are the slot used to address the shared transform buffer
+Prelude.TRANSFORM_FLOATS_PER_SLOT = 10; // x, y, z, yaw, pitch, roll, r, g, b, a
+
+// Field masks for game.markTransformsDirty(firstSlot, slotCount, fieldMask); only marked fields are applied
+Prelude.TRANSFORM_FIELD_POSITION = 1;
+Prelude.TRANSFORM_FIELD_ORIENTATION = 2;
+Prelude.TRANSFORM_FIELD_COLOR = 4;
+
+Prelude.handleSlot = function (handle) {
+    return handle & 0xFFFFF;
+};
@@ -0,0 +1,127 @@
+// Scheduler.js - Frame-budgeted scheduler for resumable (generator) script tasks
+//
+// Usage:
+//   Scheduler.spawn("name", function* () { ...; yield; ... }, Scheduler.Priority.NORMAL);
+//
+// Each frame the game calls Scheduler.tick(budgetMs). Tasks are resumed one step (up to the next
+// yield) at a time until the budget is spent. The task with the highest priority plus aging bonus
+// runs next, so low-priority tasks still make progress while high-priority work keeps yielding.
+//
+// The game only calls tick while the task count reported through game.setScriptTaskCount is non-zero.
+// Only generator tasks are budgeted: async functions and promise callbacks run on V8's microtask
+// queue as soon as the current script returns, outside of any frame budget.
+
+var Scheduler = Scheduler || {};
+
+Scheduler.Priority = { LOW: 0, NORMAL: 1, HIGH: 2 };
+
+// Each step a task waits adds this much to its effective priority
+Scheduler.agingPerStep = 0.25;
+
+Scheduler.tasks = [];
+Scheduler.nextId = 1;
+
+// Tells the game whether it needs to call tick at all
+Scheduler.notifyTaskCount = function () {
+    if (typeof game !== "undefined") {
+        game.setScriptTaskCount(Scheduler.tasks.length);
+    }
+};
+
+Scheduler.now = (typeof performance !== "undefined" && performance.now)
+    ? function () { return performance.now(); }
+    : function () { return Date.now(); };
+
+// task may be a generator function or an already-created iterator; returns the task id
+Scheduler.spawn = function (name, task, priority) {
+    var iterator = (typeof task === "function") ? task() : task;
+
+    if (!iterator || typeof iterator.next !== "function") {
+        console.log("Scheduler.spawn: '" + name + "' is not a generator");
+        return 0;
+    }
+
+    var id = Scheduler.nextId++;
+
+    Scheduler.tasks.push({
+        id: id,
+        name: name,
+        iterator: iterator,
+        priority: (priority === undefined) ? Scheduler.Priority.NORMAL : priority,
+        age: 0,
+        warned: false
+    });
+
+    Scheduler.notifyTaskCount();
+
+    return id;
+};
+
+Scheduler.cancel = function (id) {
+    for (var i = 0; i < Scheduler.tasks.length; i++) {
+        if (Scheduler.tasks[i].id === id) {
+            Scheduler.tasks.splice(i, 1);
+            Scheduler.notifyTaskCount();
+            return true;
+        }
+    }
+    return false;
+};
+
+Scheduler.getTaskCount = function () {
+    return Scheduler.tasks.length;
+};
+
+// Runs task steps until budgetMs is spent. A task whose single step exceeds the whole budget is
+// reported to the game once
+Scheduler.tick = function (budgetMs) {
+    var tasks = Scheduler.tasks;
+    var start = Scheduler.now();
+    var countBefore = tasks.length;
+
+    while (tasks.length > 0 && Scheduler.now() - start < budgetMs) {
+        var bestIndex = 0;
+        var bestScore = -Infinity;
+
+        for (var i = 0; i < tasks.length; i++) {
+            var score = tasks[i].priority + tasks[i].age * Scheduler.agingPerStep;
+            if (score > bestScore) {
+                bestScore = score;
+                bestIndex = i;
+            }
+        }
+
+        var task = tasks[bestIndex];
+        var stepStart = Scheduler.now();
+        var result;
+
+        try {
+            result = task.iterator.next();
+        } catch (error) {
+            console.log("Scheduler: task '" + task.name + "' threw: " + error);
+            result = { done: true };
+        }
+
+        var stepMs = Scheduler.now() - stepStart;
+
+        if (stepMs > budgetMs && !task.warned) {
+            task.warned = true;
+            if (typeof game !== "undefined") {
+                game.reportScriptTaskOverBudget(task.name, stepMs);
+            }
+        }
+
+        for (var j = 0; j < tasks.length; j++) {
+            tasks[j].age++;
+        }
+        task.age = 0;
+
+        if (result.done) {
+            tasks.splice(tasks.indexOf(task), 1);
+        }
+    }
+
+    if (tasks.length !== countBefore) {
+        Scheduler.notifyTaskCount();
+    }
+};
@@ -37,13 +37,18 @@ function gameObjectTests() {
     var playerPos = game.getPlayerPosition();
     console.log("Current player position: x=" + playerPos.x + ", y=" + playerPos.y + ", z=" + playerPos.z);
 
-    // Create a cube
-    game.createCube(0, 0, 5);
+    // Create a cube (createCube returns a handle to the new prop)
+    var cube = game.createCube(0, 0, 5);
     console.log("Created cube at (0, 0, 5)");
 
-    // Move prop
-    game.moveProp(0, 3, 3, 1);
-    console.log("Moved prop 0 to position (3, 3, 1)");
+    // Move prop by handle
+    game.moveProp(cube, 3, 3, 1);
+    console.log("Moved cube to position (3, 3, 1)");
+
+    // Remove prop; the handle is invalid afterwards
+    var temporaryCube = game.createCube(0, 0, 8);
+    game.removeProp(temporaryCube);
+    console.log("Created and removed a temporary cube");
 }
 
 // Complex pattern tests
@@ -54,14 +59,16 @@ function patternTests() {
     function createCirclePattern(radius, count) {
         console.log("Creating circle pattern, radius: " + radius + ", number of objects: " + count);
 
+        var positions = new Float32Array(count * 3);
+
         for (var i = 0; i < count; i++) {
             var angle = (i / count) * 2 * Math.PI;
-            var x = Math.cos(angle) * radius;
-            var y = Math.sin(angle) * radius;
-            var z = 0;
-
-            game.createCube(x, y, z);
+            positions[i * 3 + 0] = Math.cos(angle) * radius;
+            positions[i * 3 + 1] = Math.sin(angle) * radius;
+            positions[i * 3 + 2] = 0;
         }
+
+        game.createCubes(positions);
     }
 
     // Create grid pattern
@@ -80,18 +87,19 @@ function patternTests() {
         console.log("Creating spiral pattern, turns: " + turns + ", radius: " + radius);
 
         var steps = turns * 20; // 20 points per turn
+        var positions = new Float32Array(steps * 3);
 
         for (var i = 0; i < steps; i++) {
             var t = i / steps;
             var angle = t * turns * 2 * Math.PI;
             var currentRadius = t * radius;
 
-            var x = Math.cos(angle) * currentRadius;
-            var y = Math.sin(angle) * currentRadius;
-            var z = t * 5; // Increase height along spiral
-
-            game.createCube(x, y, z);
+            positions[i * 3 + 0] = Math.cos(angle) * currentRadius;
+            positions[i * 3 + 1] = Math.sin(angle) * currentRadius;
+            positions[i * 3 + 2] = t * 5; // Increase height along spiral
         }
+
+        game.createCubes(positions);
     }
 
     // Run pattern tests
@@ -120,46 +128,49 @@ function animationTests() {
         }
     }
 
-    // Wave pattern animation
+    // Wave pattern animation (21x21 cubes, spawned in a single createCubes call)
     function createWavePattern() {
         console.log("Creating wave pattern");
 
+        var positions = new Float32Array(21 * 21 * 3);
+        var colors = new Uint8Array(21 * 21 * 4);
+        var index = 0;
+
         for (var x = -10; x <= 10; x++) {
             for (var y = -10; y <= 10; y++) {
                 var distance = Math.sqrt(x * x + y * y);
                 var height = Math.sin(distance - time * 2) * 2 + 3;
 
-                game.createCube(x, y, height);
+                positions[index * 3 + 0] = x;
+                positions[index * 3 + 1] = y;
+                positions[index * 3 + 2] = height;
+
+                colors[index * 4 + 0] = 100 + (height / 5) * 155;
+                colors[index * 4 + 1] = 100;
+                colors[index * 4 + 2] = 255 - (height / 5) * 155;
+                colors[index * 4 + 3] = 255;
+                index++;
             }
         }
+
+        // One handle per cube, usable right away with moveProp/removeProp
+        var handles = game.createCubes(positions, colors);
+        console.log("Wave pattern spawned " + handles.length + " cubes");
     }
 
     createSwingingCubes();
-    // createWavePattern(); // Commented out because it creates too many cubes
+    createWavePattern();
 }
 
 // Math utility functions
 function mathUtils() {
     console.log("=== Math Utilities Tests ===");
 
-    // Distance calculation
-    function distance3D(x1, y1, z1, x2, y2, z2) {
-        var dx = x2 - x1;
-        var dy = y2 - y1;
-        var dz = z2 - z1;
-        return Math.sqrt(dx * dx + dy * dy + dz * dz);
-    }
-
-    // Linear interpolation
-    function lerp(a, b, t) {
-        return a + (b - a) * t;
-    }
-
-    // Test math functions
-    var dist = distance3D(0, 0, 0, 3, 4, 0);
+    // Test math functions (provided by Data/Scripts/Library/Prelude.js)
+    var dist = Prelude.distance3D(0, 0, 0, 3, 4, 0);
     console.log("Distance from (0,0,0) to (3,4,0): " + dist);
 
-    var interpolated = lerp(10, 20, 0.5);
+    var interpolated = Prelude.lerp(10, 20, 0.5);
     console.log("50% interpolation between 10 and 20: " + interpolated);
 
     // Generate random positions
@@ -207,6 +218,7 @@ function gameLogicTests() {
     function spawnEnemy(x, y, z) {
         var enemy = {
             id: gameState.enemies.length,
+            handle: game.createCube(x, y, z),
             x: x,
             y: y,
             z: z,
@@ -214,24 +226,40 @@ function gameLogicTests() {
         };
 
         gameState.enemies.push(enemy);
-        game.createCube(x, y, z);
         console.log("Spawned enemy " + enemy.id + " at position (" + x + ", " + y + ", " + z + ")");
 
         return enemy;
     }
 
-    // Move all enemies
+    // Move all enemies; when their slots are contiguous, all positions go through one writePositions call
     function moveEnemies() {
         console.log("Moving all enemies...");
 
-        for (var i = 0; i < gameState.enemies.length; i++) {
-            var enemy = gameState.enemies[i];
+        var enemies = gameState.enemies;
+        var firstSlot = Prelude.handleSlot(enemies[0].handle);
+        var isContiguous = true;
+        var positions = new Float32Array(enemies.length * 3);
+
+        for (var i = 0; i < enemies.length; i++) {
+            var enemy = enemies[i];
             enemy.x += (Math.random() - 0.5) * 2;
             enemy.y += (Math.random() - 0.5) * 2;
 
-            game.moveProp(i, enemy.x, enemy.y, enemy.z);
+            positions[i * 3 + 0] = enemy.x;
+            positions[i * 3 + 1] = enemy.y;
+            positions[i * 3 + 2] = enemy.z;
+
+            isContiguous = isContiguous && Prelude.handleSlot(enemy.handle) === firstSlot + i;
             console.log("Enemy " + enemy.id + " moved to (" + enemy.x.toFixed(2) + ", " + enemy.y.toFixed(2) + ", " + enemy.z + ")");
         }
+
+        if (isContiguous) {
+            game.writePositions(firstSlot, positions);
+        } else {
+            for (var j = 0; j < enemies.length; j++) {
+                game.moveProp(enemies[j].handle, enemies[j].x, enemies[j].y, enemies[j].z);
+            }
+        }
     }
 
     // Run game logic tests
@@ -247,31 +275,31 @@ function gameLogicTests() {
     moveEnemies();
 }
 
-// Main test function
-function runAllTests() {
+// Main test function, one test group per frame when run through the Scheduler
+function* runAllTestsTask() {
     console.log("Starting all JavaScript tests...");
     console.log("=====================================");
 
-    basicTests();
-    console.log("");
-
-    gameObjectTests();
-    console.log("");
-
-    mathUtils();
-    console.log("");
-
-    patternTests();
-    console.log("");
+    var groups = [basicTests, gameObjectTests, mathUtils, patternTests, animationTests, gameLogicTests];
 
-    animationTests();
-    console.log("");
-
-    gameLogicTests();
-    console.log("");
+    for (var i = 0; i < groups.length; i++) {
+        groups[i]();
+        console.log("");
+        yield;
+    }
 
     console.log("=====================================");
     console.log("All tests completed!");
 }
 
-runAllTests();
\ No newline at end of file
+function runAllTests() {
+    var task = runAllTestsTask();
+    while (!task.next().done) {
+    }
+}
+
+if (typeof Scheduler !== "undefined") {
+    Scheduler.spawn("runAllTests", runAllTestsTask);
+} else {
+    runAllTests();
+}
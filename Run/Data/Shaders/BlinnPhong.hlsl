@@ -1,7 +1,8 @@
 //----------------------------------------------------------------------------------------------------
 // Blinn-Phong (lit) shader for Squirrel Eiserloh's C34 SD student Engine (Spring 2025)
 //
-// Requires Vertex_PCUTBN vertex data (including valid tangent, bitangent, normal).
+// Requires Vertex_PCUTBN vertex data (including valid tangent, bitangent, normal), or one of the
+// packed layouts selected by PACKED_VERTEX_FORMAT below.
 //----------------------------------------------------------------------------------------------------
 // D3D11 basic rendering pipeline stages (and D3D11 function prefixes):
 //	IA = Input Assembly (grouping verts 3 at a time to form triangles, or N to form lines, fans, chains, etc.)
@@ -27,6 +28,19 @@
 //	m_d3dContext->OMSetDepthStencilState( m_depthStencilState, 0 );		// Set depth & stencil mode for Output Merger
 //----------------------------------------------------------------------------------------------------
 
+//----------------------------------------------------------------------------------------------------
+// Vertex format; must match the input layout created on the C++ side (see Game/Framework/PackedVertex.hpp).
+// The Engine only creates the Vertex_PCUTBN layout today, so formats 1 and 2 stay unused until it can create theirs.
+//	0 = Vertex_PCUTBN (60 bytes)
+//	1 = sPackedVertex_PCUTBN (28 bytes): float3 position, half2 UVs, octahedral normal & tangent, no bitangent
+//	2 = sQuantizedVertex_PCUTBN (24 bytes): as 1, but 16-bit SNORM position relative to the mesh bounds;
+//		C++ multiplies sPositionQuantization::GetDequantizeTransform() into c_modelToWorld, so the only
+//		extra cost here is that world-space directions come out uniformly scaled (normalized in the PS anyway)
+//----------------------------------------------------------------------------------------------------
+#ifndef PACKED_VERTEX_FORMAT
+#define PACKED_VERTEX_FORMAT 0
+#endif
+
 //----------------------------------------------------------------------------------------------------
 // Input to the Vertex shader stage.
 // Information contained per vertex, pulled from the VBO being drawn.
@@ -35,12 +49,24 @@ struct VertexInput
 {
 	// "v_" stands for for "Vertex" attribute which comes directly from VBO data (Squirrel's convention)
 	// The all-caps "semantic names" are arbitrary symbol to associate CPU-GPU and other linkages.
+#if PACKED_VERTEX_FORMAT == 0
 	float3	a_position		: VERTEX_POSITION;
 	float4	a_color			: VERTEX_COLOR; // Expanded to float[0.f,1.f] from byte[0,255] because "UNORM" in DXGI_FORMAT_R8G8B8A8_UNORM
 	float2	a_uvTexCoords	: VERTEX_UVTEXCOORDS;
 	float3	a_tangent		: VERTEX_TANGENT;
 	float3	a_bitangent		: VERTEX_BITANGENT;
 	float3	a_normal		: VERTEX_NORMAL;
+#else
+#if PACKED_VERTEX_FORMAT == 1
+	float3	a_position		: VERTEX_POSITION;	// DXGI_FORMAT_R32G32B32_FLOAT
+#else
+	float4	a_position		: VERTEX_POSITION;	// DXGI_FORMAT_R16G16B16A16_SNORM, [-1,1] within the mesh bounds (w = 1)
+#endif
+	float4	a_color			: VERTEX_COLOR;		// DXGI_FORMAT_R8G8B8A8_UNORM
+	float2	a_uvTexCoords	: VERTEX_UVTEXCOORDS;	// DXGI_FORMAT_R16G16_FLOAT, expanded to float by the Input Assembler
+	float2	a_octNormal		: VERTEX_NORMAL;	// DXGI_FORMAT_R16G16_SNORM, octahedral-encoded unit normal
+	float2	a_octTangent	: VERTEX_TANGENT;	// DXGI_FORMAT_R16G16_SNORM, octahedral tangent with bitangent sign folded into y
+#endif
 
 	// Built-in / automatic attributes (not part of incoming VBO data)
 	// "SV_" means "System Variable" and is a built-in special reserved semantic
@@ -194,6 +220,31 @@ SamplerState		s_diffuseSampler	: register(s0);			// Sampler is bound in sampler
 SamplerState		s_normalSampler		: register(s1);			// Sampler is bound in sampler constant slot #1 (s1)
 SamplerState		s_specGlossEmitSampler : register(s2); 		// Sampler is bound in sampler constant slot #2 (s2)
 
+//----------------------------------------------------------------------------------------------------
+// Packed vertex decoding; mirrors the C++ decoders in Game/Framework/PackedVertex.cpp
+//----------------------------------------------------------------------------------------------------
+float3 DecodeOctahedral( float2 encoded )
+{
+	float3 direction = float3( encoded.x, encoded.y, 1.0 - abs( encoded.x ) - abs( encoded.y ) );
+	float folded = saturate( -direction.z );
+	direction.xy += (direction.xy >= 0.0) ? -folded : folded;	// Unfold the lower hemisphere back across the diagonals
+	return normalize( direction );
+}
+
+//----------------------------------------------------------------------------------------------------
+// The tangent's y stores (y+1)/2 * 32766 + 1 with the bitangent sign as its sign, so it is never 0
+//----------------------------------------------------------------------------------------------------
+void DecodePackedTangentFrame( float2 octNormal, float2 octTangent, out float3 tangent, out float3 bitangent, out float3 normal )
+{
+	float handedness = (octTangent.y < 0.0) ? -1.0 : 1.0;
+	float tangentY = (abs( octTangent.y ) * 32767.0 - 1.0) * (2.0 / 32766.0) - 1.0;
+
+	normal		= DecodeOctahedral( octNormal );
+	tangent		= DecodeOctahedral( float2( octTangent.x, tangentY ) );
+	bitangent	= cross( normal, tangent ) * handedness;
+}
+
+
 //----------------------------------------------------------------------------------------------------
 // VERTEX SHADER (VS)
 //
@@ -210,16 +261,26 @@ VertexOutPixelIn VertexMain( VertexInput input )
 	VertexOutPixelIn output;
 
 	// Transform the position through the pipeline
-	float4 modelPos = float4( input.a_position, 1.0 );	// VBOs provide vertexes in model space
+	float4 modelPos = float4( input.a_position.xyz, 1.0 );	// VBOs provide vertexes in model space (or mesh-bounds space when quantized)
 	float4 worldPos		= mul( c_modelToWorld, modelPos );		// Model space (+X local forward) to World space (+X east)
 	float4 cameraPos	= mul( c_worldToCamera, worldPos );		// World space (+X east) to Camera space (+X camera-forward)
 	float4 renderPos	= mul( c_cameraToRender, cameraPos );	// Camera space (+X cam-fwd) to Render space (+X right/+Z fwd)
 	float4 clipPos		= mul( c_renderToClip, renderPos );		// Render space to Clip space (range-map/FOV/aspect, and put Z in W, preparing for W-divide)
 
 	// Transform the tangents, normals, and bitangents (using W=0 for directions)
-	float4 modelTangent		= float4( input.a_tangent, 0.0 );
-	float4 modelBitangent	= float4( input.a_bitangent, 0.0 );
-	float4 modelNormal		= float4( input.a_normal, 0.0 );
+#if PACKED_VERTEX_FORMAT == 0
+	float3 vertexTangent	= input.a_tangent;
+	float3 vertexBitangent	= input.a_bitangent;
+	float3 vertexNormal		= input.a_normal;
+#else
+	float3 vertexTangent;
+	float3 vertexBitangent;
+	float3 vertexNormal;
+	DecodePackedTangentFrame( input.a_octNormal, input.a_octTangent, vertexTangent, vertexBitangent, vertexNormal );
+#endif
+	float4 modelTangent		= float4( vertexTangent, 0.0 );
+	float4 modelBitangent	= float4( vertexBitangent, 0.0 );
+	float4 modelNormal		= float4( vertexNormal, 0.0 );
 	float4 worldTangent		= mul( c_modelToWorld, modelTangent );		// Note: here we multiply on the right (M*V) since our C++ matrices come in from our constant
 	float4 worldBitangent	= mul( c_modelToWorld, modelBitangent );	//	buffers from C++ as basis-major (as opposed to component-major).  Be careful below when
 	float4 worldNormal		= mul( c_modelToWorld, modelNormal );		//	we must reverse the multiplication order (V*M) when using HLSL's float3x3 constructor!